@@ -0,0 +1,61 @@
+
+#include "../Flare.h"
+#include "FlareCatalogLoader.h"
+#include "AssetRegistryModule.h"
+
+
+/*----------------------------------------------------
+	Interaction
+----------------------------------------------------*/
+
+void FFlareCatalogLoader::Start(UClass* EntryClass, FStreamableDelegate Callback)
+{
+	TArray<FAssetData> AssetList;
+	const IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	Registry.GetAssetsByClass(EntryClass->GetFName(), AssetList);
+
+	for (int32 Index = 0; Index < AssetList.Num(); Index++)
+	{
+		FLOGV("FFlareCatalogLoader::Start : Found '%s'", *AssetList[Index].GetFullName());
+		Assets.Add(FStringAssetReference(AssetList[Index].ObjectPath.ToString()));
+	}
+
+	Streamable.RequestAsyncLoad(Assets, Callback);
+}
+
+void FFlareCatalogLoader::Wait(TArray<UObject*>& Entries)
+{
+	// Loaded entries are found immediately, the others are loaded now
+	for (int32 Index = 0; Index < Assets.Num(); Index++)
+	{
+		UObject* Entry = Streamable.SynchronousLoad(Assets[Index]);
+		FCHECK(Entry);
+		Entries.Add(Entry);
+	}
+}
+
+UObject* FFlareCatalogLoader::LoadAsset(const FStringAssetReference& Asset)
+{
+	if (!Asset.IsValid())
+	{
+		return NULL;
+	}
+
+	return GetAssetStreamable().SynchronousLoad(Asset);
+}
+
+void FFlareCatalogLoader::PreloadAssets(const TArray<FStringAssetReference>& Assets, FStreamableDelegate Callback)
+{
+	GetAssetStreamable().RequestAsyncLoad(Assets, Callback);
+}
+
+bool FFlareCatalogLoader::IsAssetLoaded(const FStringAssetReference& Asset)
+{
+	return !Asset.IsValid() || GetAssetStreamable().IsAsyncLoadComplete(Asset);
+}
+
+FStreamableManager& FFlareCatalogLoader::GetAssetStreamable()
+{
+	static FStreamableManager AssetStreamable;
+	return AssetStreamable;
+}
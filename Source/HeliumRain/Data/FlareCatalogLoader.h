@@ -0,0 +1,44 @@
+#pragma once
+
+#include "../Flare.h"
+#include "Engine/StreamableManager.h"
+
+
+/** Asynchronous loader for the entries of a catalog */
+class FFlareCatalogLoader
+{
+public:
+
+	/*----------------------------------------------------
+		Interaction
+	----------------------------------------------------*/
+
+	/** Find the catalog entries of this class in the asset registry and start loading them */
+	void Start(UClass* EntryClass, FStreamableDelegate Callback);
+
+	/** Get all catalog entries, waiting for the ones still loading */
+	void Wait(TArray<UObject*>& Entries);
+
+	/** Get an asset referenced by a catalog entry, loading it now if needed */
+	static UObject* LoadAsset(const FStringAssetReference& Asset);
+
+	/** Start loading assets referenced by catalog entries, before they are needed */
+	static void PreloadAssets(const TArray<FStringAssetReference>& Assets, FStreamableDelegate Callback);
+
+	/** Check if an asset referenced by a catalog entry is loaded */
+	static bool IsAssetLoaded(const FStringAssetReference& Asset);
+
+
+protected:
+
+	/** Streamable manager keeping the assets referenced by catalog entries once loaded */
+	static FStreamableManager& GetAssetStreamable();
+
+	/*----------------------------------------------------
+		Protected data
+	----------------------------------------------------*/
+
+	FStreamableManager                              Streamable;
+	TArray<FStringAssetReference>                   Assets;
+
+};
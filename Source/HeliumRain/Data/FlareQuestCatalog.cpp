@@ -1,7 +1,6 @@
 
 #include "../Flare.h"
 #include "FlareQuestCatalog.h"
-#include "AssetRegistryModule.h"
 
 
 /*----------------------------------------------------
@@ -10,16 +9,36 @@
 
 UFlareQuestCatalog::UFlareQuestCatalog(const class FObjectInitializer& PCIP)
 	: Super(PCIP)
+	, Loaded(false)
 {
-	TArray<FAssetData> AssetList;
-	const IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
-	Registry.GetAssetsByClass(UFlareQuestCatalogEntry::StaticClass()->GetFName(), AssetList);
+	// Templates don't need any data
+	if (!IsTemplate())
+	{
+		Loader.Start(UFlareQuestCatalogEntry::StaticClass(), FStreamableDelegate::CreateUObject(this, &UFlareQuestCatalog::OnEntriesLoaded));
+	}
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
 
-	for (int32 Index = 0; Index < AssetList.Num(); Index++)
+void UFlareQuestCatalog::OnEntriesLoaded()
+{
+	if (Loaded)
+	{
+		return;
+	}
+
+	TArray<UObject*> Entries;
+	Loader.Wait(Entries);
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
 	{
-		FLOGV("UFlareQuestCatalog::UFlareQuestCatalog : Found '%s'", *AssetList[Index].GetFullName());
-		UFlareQuestCatalogEntry* Quest = Cast<UFlareQuestCatalogEntry>(AssetList[Index].GetAsset());
+		UFlareQuestCatalogEntry* Quest = Cast<UFlareQuestCatalogEntry>(Entries[EntryIndex]);
 		FCHECK(Quest);
 		Quests.Add(Quest);
 	}
+
+	Loaded = true;
 }
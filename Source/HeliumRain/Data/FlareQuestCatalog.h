@@ -1,6 +1,7 @@
 #pragma once
 
 #include "FlareQuestCatalogEntry.h"
+#include "FlareCatalogLoader.h"
 #include "FlareQuestCatalog.generated.h"
 
 
@@ -19,4 +20,36 @@ public:
 	UPROPERTY(EditAnywhere, Category = Content)
 	TArray<UFlareQuestCatalogEntry*> Quests;
 
+public:
+
+	/*----------------------------------------------------
+		Public methods
+	----------------------------------------------------*/
+
+	/** Wait until all entries are loaded */
+	inline void WaitForLoad()
+	{
+		if (!Loaded)
+		{
+			OnEntriesLoaded();
+		}
+	}
+
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Store the catalog entries once they are loaded */
+	void OnEntriesLoaded();
+
+
+	/*----------------------------------------------------
+		Protected data
+	----------------------------------------------------*/
+
+	FFlareCatalogLoader                              Loader;
+	bool                                             Loaded;
+
 };
@@ -1,6 +1,5 @@
 #include "../Flare.h"
 #include "FlareResourceCatalog.h"
-#include "AssetRegistryModule.h"
 
 
 /*----------------------------------------------------
@@ -9,18 +8,37 @@
 
 UFlareResourceCatalog::UFlareResourceCatalog(const class FObjectInitializer& PCIP)
 	: Super(PCIP)
+	, Loaded(false)
 {
-	TArray<FAssetData> AssetList;
-	const IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
-	Registry.GetAssetsByClass(UFlareResourceCatalogEntry::StaticClass()->GetFName(), AssetList);
+	// Templates don't need any data
+	if (!IsTemplate())
+	{
+		Loader.Start(UFlareResourceCatalogEntry::StaticClass(), FStreamableDelegate::CreateUObject(this, &UFlareResourceCatalog::OnEntriesLoaded));
+	}
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
 
-	for (int32 Index = 0; Index < AssetList.Num(); Index++)
+void UFlareResourceCatalog::OnEntriesLoaded()
+{
+	if (Loaded)
 	{
-		FLOGV("UFlareResourceCatalog::UFlareResourceCatalog : Found '%s'", *AssetList[Index].GetFullName());
-		UFlareResourceCatalogEntry* Resource = Cast<UFlareResourceCatalogEntry>(AssetList[Index].GetAsset());
+		return;
+	}
+
+	TArray<UObject*> Entries;
+	Loader.Wait(Entries);
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+	{
+		UFlareResourceCatalogEntry* Resource = Cast<UFlareResourceCatalogEntry>(Entries[EntryIndex]);
 		FCHECK(Resource);
 		
 		Resources.Add(Resource);
+		Index.Add(Resource->Data.Identifier, Resource);
 
 		if (Resource->Data.IsConsumerResource)
 		{
@@ -37,6 +55,8 @@ UFlareResourceCatalog::UFlareResourceCatalog(const class FObjectInitializer& PCI
 	Resources.Sort(SortByResourceType);
 	ConsumerResources.Sort(SortByResourceType);
 	MaintenanceResources.Sort(SortByResourceType);
+
+	Loaded = true;
 }
 
 
@@ -46,18 +66,8 @@ UFlareResourceCatalog::UFlareResourceCatalog(const class FObjectInitializer& PCI
 
 FFlareResourceDescription* UFlareResourceCatalog::Get(FName Identifier) const
 {
-	auto FindByName = [=](const UFlareResourceCatalogEntry* Candidate)
-	{
-		return Candidate->Data.Identifier == Identifier;
-	};
-
-	UFlareResourceCatalogEntry* const* Entry = Resources.FindByPredicate(FindByName);
-	if (Entry && *Entry)
-	{
-		return &((*Entry)->Data);
-	}
-
-	return NULL;
+	UFlareResourceCatalogEntry* Entry = Index.FindRef(Identifier);
+	return (Entry ? &Entry->Data : NULL);
 }
 
 UFlareResourceCatalogEntry* UFlareResourceCatalog::GetEntry(FFlareResourceDescription* Resource) const
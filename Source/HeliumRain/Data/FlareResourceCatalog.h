@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Economy/FlareFactory.h"
+#include "FlareCatalogLoader.h"
 #include "FlareResourceCatalog.generated.h"
 
 
@@ -45,6 +46,33 @@ public:
 		return Resources;
 	}
 
+	/** Wait until all entries are loaded */
+	inline void WaitForLoad()
+	{
+		if (!Loaded)
+		{
+			OnEntriesLoaded();
+		}
+	}
+
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Sort and index the catalog entries once they are loaded */
+	void OnEntriesLoaded();
+
+
+	/*----------------------------------------------------
+		Protected data
+	----------------------------------------------------*/
+
+	FFlareCatalogLoader                              Loader;
+	bool                                             Loaded;
+	TMap<FName, UFlareResourceCatalogEntry*>         Index;
+
 };
 
 inline static bool SortByResourceType(const UFlareResourceCatalogEntry& ResourceA, const UFlareResourceCatalogEntry& ResourceB)
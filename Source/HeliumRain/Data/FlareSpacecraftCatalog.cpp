@@ -1,7 +1,6 @@
 
 #include "../Flare.h"
 #include "FlareSpacecraftCatalog.h"
-#include "AssetRegistryModule.h"
 
 
 /*----------------------------------------------------
@@ -10,15 +9,33 @@
 
 UFlareSpacecraftCatalog::UFlareSpacecraftCatalog(const class FObjectInitializer& PCIP)
 	: Super(PCIP)
+	, Loaded(false)
 {
-	TArray<FAssetData> AssetList;
-	const IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
-	Registry.GetAssetsByClass(UFlareSpacecraftCatalogEntry::StaticClass()->GetFName(), AssetList);
+	// Templates don't need any data
+	if (!IsTemplate())
+	{
+		Loader.Start(UFlareSpacecraftCatalogEntry::StaticClass(), FStreamableDelegate::CreateUObject(this, &UFlareSpacecraftCatalog::OnEntriesLoaded));
+	}
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void UFlareSpacecraftCatalog::OnEntriesLoaded()
+{
+	if (Loaded)
+	{
+		return;
+	}
 
-	for (int32 Index = 0; Index < AssetList.Num(); Index++)
+	TArray<UObject*> Entries;
+	Loader.Wait(Entries);
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
 	{
-		FLOGV("UFlareSpacecraftCatalog::UFlareSpacecraftCatalog : Found '%s'", *AssetList[Index].GetFullName());
-		UFlareSpacecraftCatalogEntry* Spacecraft = Cast<UFlareSpacecraftCatalogEntry>(AssetList[Index].GetAsset());
+		UFlareSpacecraftCatalogEntry* Spacecraft = Cast<UFlareSpacecraftCatalogEntry>(Entries[EntryIndex]);
 		FCHECK(Spacecraft);
 
 		if (Spacecraft->Data.IsStation())
@@ -29,7 +46,11 @@ UFlareSpacecraftCatalog::UFlareSpacecraftCatalog(const class FObjectInitializer&
 		{
 			ShipCatalog.Add(Spacecraft);
 		}
+
+		Index.Add(Spacecraft->Data.Identifier, Spacecraft);
 	}
+
+	Loaded = true;
 }
 
 
@@ -39,23 +60,7 @@ UFlareSpacecraftCatalog::UFlareSpacecraftCatalog(const class FObjectInitializer&
 
 FFlareSpacecraftDescription* UFlareSpacecraftCatalog::Get(FName Identifier) const
 {
-	auto FindByName = [=](const UFlareSpacecraftCatalogEntry* Candidate)
-	{
-		return Candidate->Data.Identifier == Identifier;
-	};
-
-	UFlareSpacecraftCatalogEntry* const* Entry = ShipCatalog.FindByPredicate(FindByName);
-	if (Entry && *Entry)
-	{
-		return &((*Entry)->Data);
-	}
-
-	Entry = StationCatalog.FindByPredicate(FindByName);
-	if (Entry && *Entry)
-	{
-		return &((*Entry)->Data);
-	}
-
-	return NULL;
+	UFlareSpacecraftCatalogEntry* Entry = Index.FindRef(Identifier);
+	return (Entry ? &Entry->Data : NULL);
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "FlareSpacecraftCatalogEntry.h"
+#include "FlareCatalogLoader.h"
 #include "../Spacecrafts/FlareSpacecraft.h"
 #include "FlareSpacecraftCatalog.generated.h"
 
@@ -33,5 +34,32 @@ public:
 	/** Get a ship from identifier */
 	FFlareSpacecraftDescription* Get(FName Identifier) const;
 
+	/** Wait until all entries are loaded */
+	inline void WaitForLoad()
+	{
+		if (!Loaded)
+		{
+			OnEntriesLoaded();
+		}
+	}
+
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Sort and index the catalog entries once they are loaded */
+	void OnEntriesLoaded();
+
+
+	/*----------------------------------------------------
+		Protected data
+	----------------------------------------------------*/
+
+	FFlareCatalogLoader                              Loader;
+	bool                                             Loaded;
+	TMap<FName, UFlareSpacecraftCatalogEntry*>       Index;
+
 
 };
@@ -1,7 +1,6 @@
 
 #include "../Flare.h"
 #include "FlareSpacecraftComponentsCatalog.h"
-#include "AssetRegistryModule.h"
 
 
 /*----------------------------------------------------
@@ -10,15 +9,33 @@
 
 UFlareSpacecraftComponentsCatalog::UFlareSpacecraftComponentsCatalog(const class FObjectInitializer& PCIP)
 	: Super(PCIP)
+	, Loaded(false)
 {
-	TArray<FAssetData> AssetList;
-	const IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
-	Registry.GetAssetsByClass(UFlareSpacecraftComponentsCatalogEntry::StaticClass()->GetFName(), AssetList);
+	// Templates don't need any data
+	if (!IsTemplate())
+	{
+		Loader.Start(UFlareSpacecraftComponentsCatalogEntry::StaticClass(), FStreamableDelegate::CreateUObject(this, &UFlareSpacecraftComponentsCatalog::OnEntriesLoaded));
+	}
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void UFlareSpacecraftComponentsCatalog::OnEntriesLoaded()
+{
+	if (Loaded)
+	{
+		return;
+	}
 
-	for (int32 Index = 0; Index < AssetList.Num(); Index++)
+	TArray<UObject*> Entries;
+	Loader.Wait(Entries);
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
 	{
-		FLOGV("UFlareSpacecraftComponentsCatalog::UFlareSpacecraftComponentsCatalog : Found '%s'", *AssetList[Index].GetFullName());
-		UFlareSpacecraftComponentsCatalogEntry* SpacecraftComponent = Cast<UFlareSpacecraftComponentsCatalogEntry>(AssetList[Index].GetAsset());
+		UFlareSpacecraftComponentsCatalogEntry* SpacecraftComponent = Cast<UFlareSpacecraftComponentsCatalogEntry>(Entries[EntryIndex]);
 		FCHECK(SpacecraftComponent);
 
 		if (SpacecraftComponent->Data.Type == EFlarePartType::OrbitalEngine)
@@ -41,7 +58,19 @@ UFlareSpacecraftComponentsCatalog::UFlareSpacecraftComponentsCatalog(const class
 		{
 			MetaCatalog.Add(SpacecraftComponent);
 		}
+		else
+		{
+			continue;
+		}
+
+		// The first entry of an identifier wins, as it did with the category lists
+		if (!Index.Contains(SpacecraftComponent->Data.Identifier))
+		{
+			Index.Add(SpacecraftComponent->Data.Identifier, SpacecraftComponent);
+		}
 	}
+
+	Loaded = true;
 }
 
 
@@ -51,56 +80,8 @@ UFlareSpacecraftComponentsCatalog::UFlareSpacecraftComponentsCatalog(const class
 
 FFlareSpacecraftComponentDescription* UFlareSpacecraftComponentsCatalog::Get(FName Identifier) const
 {
-	FFlareSpacecraftComponentDescription* Part = NULL;
-
-	auto FindByName = [=](const UFlareSpacecraftComponentsCatalogEntry* Candidate)
-	{
-		return Candidate && Candidate->Data.Identifier == Identifier;
-	};
-
-	UFlareSpacecraftComponentsCatalogEntry* const* Temp = EngineCatalog.FindByPredicate(FindByName);
-	if (Temp)
-	{
-		Part = &(*Temp)->Data;
-	}
-
-	if (!Part)
-	{
-		Temp = RCSCatalog.FindByPredicate(FindByName);
-		if (Temp)
-		{
-			Part = &(*Temp)->Data;
-		}
-	}
-
-	if (!Part)
-	{
-		Temp = WeaponCatalog.FindByPredicate(FindByName);
-		if (Temp)
-		{
-			Part = &(*Temp)->Data;
-		}
-	}
-
-	if (!Part)
-	{
-		Temp = InternalComponentsCatalog.FindByPredicate(FindByName);
-		if (Temp)
-		{
-			Part = &(*Temp)->Data;
-		}
-	}
-	
-	if (!Part)
-	{
-		Temp = MetaCatalog.FindByPredicate(FindByName);
-		if (Temp)
-		{
-			Part = &(*Temp)->Data;
-		}
-	}
-
-	return Part;
+	UFlareSpacecraftComponentsCatalogEntry* Entry = Index.FindRef(Identifier);
+	return (Entry ? &Entry->Data : NULL);
 }
 
 const void UFlareSpacecraftComponentsCatalog::GetEngineList(TArray<FFlareSpacecraftComponentDescription*>& OutData, TEnumAsByte<EFlarePartSize::Type> Size)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "FlareSpacecraftComponentsCatalogEntry.h"
+#include "FlareCatalogLoader.h"
 #include "FlareSpacecraftComponentsCatalog.generated.h"
 
 
@@ -53,5 +54,32 @@ public:
 	/** Search all weapons and get one that fits */
 	const void GetWeaponList(TArray<FFlareSpacecraftComponentDescription*>& OutData, TEnumAsByte<EFlarePartSize::Type> Size);
 
+	/** Wait until all entries are loaded */
+	inline void WaitForLoad()
+	{
+		if (!Loaded)
+		{
+			OnEntriesLoaded();
+		}
+	}
+
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Sort and index the catalog entries once they are loaded */
+	void OnEntriesLoaded();
+
+
+	/*----------------------------------------------------
+		Protected data
+	----------------------------------------------------*/
+
+	FFlareCatalogLoader                              Loader;
+	bool                                             Loaded;
+	TMap<FName, UFlareSpacecraftComponentsCatalogEntry*> Index;
+
 
 };
@@ -720,7 +720,7 @@ uint32 UFlareFactory::GetOutputLimit(FFlareResourceDescription* Resource)
 			return FactoryData.OutputCargoLimit[CargoLimitIndex].Quantity;
 		}
 	}
-	FLOGV("No output limit for %s", *Resource->Identifier.ToString());
+	FLOGCV(LogFlareEconomy, "No output limit for %s", *Resource->Identifier.ToString());
 	return 0;
 }
 
@@ -174,7 +174,7 @@ void UFlarePeople::SimulateResourcePurchase()
 	uint32 FoodConsumption = GetRessourceConsumption(Food, true);
 	uint32 BoughtFood = BuyResourcesInSector(Food, FoodConsumption); // In Tons
 	//if(BoughtFood)
-	//	FLOGV("People in %s bought %u food", *Parent->GetSectorName().ToString(), BoughtFood);
+	//	FLOGCV(LogFlareEconomy, "People in %s bought %u food", *Parent->GetSectorName().ToString(), BoughtFood);
 	PeopleData.FoodStock += BoughtFood * 1000; // In kg
 
 	if(FoodConsumption == BoughtFood)
@@ -194,7 +194,7 @@ void UFlarePeople::SimulateResourcePurchase()
 	uint32 FuelConsumption = GetRessourceConsumption(Fuel, true);
 	uint32 BoughtFuel = BuyResourcesInSector(Fuel, FuelConsumption); // In Tons
 	//if(BoughtFuel)
-	//	FLOGV("People in %s bought %u fuel", *Parent->GetSectorName().ToString(), BoughtFuel);
+	//	FLOGCV(LogFlareEconomy, "People in %s bought %u fuel", *Parent->GetSectorName().ToString(), BoughtFuel);
 	PeopleData.FuelStock += BoughtFuel * 1000; // In kg
 
 	if(FuelConsumption == BoughtFuel)
@@ -214,7 +214,7 @@ void UFlarePeople::SimulateResourcePurchase()
 	uint32 ToolConsumption = GetRessourceConsumption(Tool, true);
 	uint32 BoughtTool = BuyResourcesInSector(Tool, ToolConsumption); // In Tons
 	//if(BoughtTool)
-	//	FLOGV("People in %s bought %u tool", *Parent->GetSectorName().ToString(), BoughtTool);
+	//	FLOGCV(LogFlareEconomy, "People in %s bought %u tool", *Parent->GetSectorName().ToString(), BoughtTool);
 	PeopleData.ToolStock += BoughtTool * 1000; // In kg
 
 	if(ToolConsumption == BoughtTool)
@@ -234,7 +234,7 @@ void UFlarePeople::SimulateResourcePurchase()
 	uint32 TechConsumption = GetRessourceConsumption(Tech, true);
 	uint32 BoughtTech = BuyResourcesInSector(Tech, TechConsumption); // In Tons
 	//if(BoughtTech)
-	//	FLOGV("People in %s bought %u tech", *Parent->GetSectorName().ToString(), BoughtTech);
+	//	FLOGCV(LogFlareEconomy, "People in %s bought %u tech", *Parent->GetSectorName().ToString(), BoughtTech);
 	PeopleData.TechStock += BoughtTech * 1000; // In kg
 
 	if(TechConsumption == BoughtTech)
@@ -449,7 +449,7 @@ void UFlarePeople::GiveBirth(uint32 BirthCount)
 		return;
 	}
 
-	//FLOGV("Give birth %u people for sector %s", BirthCount, *Parent->GetSectorName().ToString());
+	//FLOGCV(LogFlareEconomy, "Give birth %u people for sector %s", BirthCount, *Parent->GetSectorName().ToString());
 
 	// Increase population
 	PeopleData.Population += BirthCount;
@@ -494,7 +494,7 @@ void UFlarePeople::KillPeople(uint32 KillCount)
 		return;
 	}
 
-	//FLOGV("Kill %u people for sector %s", KillCount, *Parent->GetSectorName().ToString());
+	//FLOGCV(LogFlareEconomy, "Kill %u people for sector %s", KillCount, *Parent->GetSectorName().ToString());
 
 
 	float KillRatio = (float) PeopleToKill / (float)PeopleData.Population;
@@ -542,7 +542,7 @@ void UFlarePeople::Migrate(UFlareSimulatedSector* DestinationSector, int32 ShipC
 		DestinationPeople->GetData()->Population += MigratingPopulation;
 		DestinationPeople->GetData()->HappinessPoint += MigratingHappiness;
 
-		FLOGV("Migration from %s to %s : %d people", *Parent->GetSectorName().ToString(), DestinationSector);
+		FLOGCV(LogFlareEconomy, "Migration from %s to %s : %d people", *Parent->GetSectorName().ToString(), DestinationSector);
 	}
 }
 
@@ -582,7 +582,7 @@ void UFlarePeople::SetHappiness(float Happiness)
 
 void UFlarePeople::Pay(uint32 Amount)
 {
-	//FLOGV("Pay to people for sector %s Amount=%f", *Parent->GetSectorName().ToString(), Amount/100.)
+	//FLOGCV(LogFlareEconomy, "Pay to people for sector %s Amount=%f", *Parent->GetSectorName().ToString(), Amount/100.);
 
 	uint32 Repayment = 0;
 	if(PeopleData.Dept > 0)
@@ -623,35 +623,35 @@ void UFlarePeople::PrintInfo()
 
 
 
-	FLOGV("People for sector %s. ", *Parent->GetSectorName().ToString())
-	FLOGV(" - population: %u", PeopleData.Population);
-	FLOGV(" - base population: %d", GetBasePopulation());
-	FLOGV(" - happiness: %f", GetHappiness());
-	//FLOGV(" - Sickness: %f", Sickness);
-	//FLOGV(" - Fertility: %f", Fertility);
-	FLOG(" - Stocks");
-	FLOGV("   - Food: %u", PeopleData.FoodStock);
-	FLOGV("   - Fuel: %u", PeopleData.FuelStock);
-	FLOGV("   - Tool: %u", PeopleData.ToolStock);
-	FLOGV("   - Tech: %u", PeopleData.TechStock);
-	FLOG(" - Consumptions (sector)");
-	FLOGV("   - Food: %f", GetRessourceConsumption(Food, false));
-	FLOGV("   - Fuel: %f", GetRessourceConsumption(Fuel, false));
-	FLOGV("   - Tool: %f", GetRessourceConsumption(Tools, false));
-	FLOGV("   - Tech: %f", GetRessourceConsumption(Tech, false));
-	FLOG(" - Consumptions (per inhabitant)");
-	FLOGV("   - Food: %f", PeopleData.FoodConsumption);
-	FLOGV("   - Fuel: %f", PeopleData.FuelConsumption);
-	FLOGV("   - Tool: %f", PeopleData.ToolConsumption);
-	FLOGV("   - Tech: %f", PeopleData.TechConsumption);
-	//FLOGV(" - FoodConsumption: %u", FoodConsumption);
-	//FLOGV(" - EatenFood: %u", EatenFood);
-	//FLOGV(" - FeedPeopleRatio: %f", FeedPeopleRatio);
-	//FLOGV(" - Delta Hunger: %u", Hunger);
-	FLOGV(" - Hunger: %u", PeopleData.HungerPoint);
-
-	FLOGV(" - Money: %f", PeopleData.Money / 100.);
-	FLOGV(" - Dept: %f", PeopleData.Dept / 100.);
+	FLOGCV(LogFlareEconomy, "People for sector %s. ", *Parent->GetSectorName().ToString());
+	FLOGCV(LogFlareEconomy, " - population: %u", PeopleData.Population);
+	FLOGCV(LogFlareEconomy, " - base population: %d", GetBasePopulation());
+	FLOGCV(LogFlareEconomy, " - happiness: %f", GetHappiness());
+	//FLOGCV(LogFlareEconomy, " - Sickness: %f", Sickness);
+	//FLOGCV(LogFlareEconomy, " - Fertility: %f", Fertility);
+	FLOGC(LogFlareEconomy, " - Stocks");
+	FLOGCV(LogFlareEconomy, "   - Food: %u", PeopleData.FoodStock);
+	FLOGCV(LogFlareEconomy, "   - Fuel: %u", PeopleData.FuelStock);
+	FLOGCV(LogFlareEconomy, "   - Tool: %u", PeopleData.ToolStock);
+	FLOGCV(LogFlareEconomy, "   - Tech: %u", PeopleData.TechStock);
+	FLOGC(LogFlareEconomy, " - Consumptions (sector)");
+	FLOGCV(LogFlareEconomy, "   - Food: %f", GetRessourceConsumption(Food, false));
+	FLOGCV(LogFlareEconomy, "   - Fuel: %f", GetRessourceConsumption(Fuel, false));
+	FLOGCV(LogFlareEconomy, "   - Tool: %f", GetRessourceConsumption(Tools, false));
+	FLOGCV(LogFlareEconomy, "   - Tech: %f", GetRessourceConsumption(Tech, false));
+	FLOGC(LogFlareEconomy, " - Consumptions (per inhabitant)");
+	FLOGCV(LogFlareEconomy, "   - Food: %f", PeopleData.FoodConsumption);
+	FLOGCV(LogFlareEconomy, "   - Fuel: %f", PeopleData.FuelConsumption);
+	FLOGCV(LogFlareEconomy, "   - Tool: %f", PeopleData.ToolConsumption);
+	FLOGCV(LogFlareEconomy, "   - Tech: %f", PeopleData.TechConsumption);
+	//FLOGCV(LogFlareEconomy, " - FoodConsumption: %u", FoodConsumption);
+	//FLOGCV(LogFlareEconomy, " - EatenFood: %u", EatenFood);
+	//FLOGCV(LogFlareEconomy, " - FeedPeopleRatio: %f", FeedPeopleRatio);
+	//FLOGCV(LogFlareEconomy, " - Delta Hunger: %u", Hunger);
+	FLOGCV(LogFlareEconomy, " - Hunger: %u", PeopleData.HungerPoint);
+
+	FLOGCV(LogFlareEconomy, " - Money: %f", PeopleData.Money / 100.);
+	FLOGCV(LogFlareEconomy, " - Dept: %f", PeopleData.Dept / 100.);
 }
 
 void UFlarePeople::CheckPopulationDisparition()
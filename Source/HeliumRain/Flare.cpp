@@ -5,6 +5,13 @@
 IMPLEMENT_PRIMARY_GAME_MODULE(FFlareModule, HeliumRain, "HeliumRain");
 
 DEFINE_LOG_CATEGORY(LogFlare)
+DEFINE_LOG_CATEGORY(LogFlareAI)
+DEFINE_LOG_CATEGORY(LogFlareEconomy)
+DEFINE_LOG_CATEGORY(LogFlareTravel)
+DEFINE_LOG_CATEGORY(LogFlareCombat)
+DEFINE_LOG_CATEGORY(LogFlareSave)
+
+FThreadSafeCounter GFlareSuppressedLogCount;
 
 
 /*----------------------------------------------------
@@ -15,6 +15,43 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogFlare, Log, All);
 
+// Subsystem logs, AI and economy are muted by default as they log for every company and sector each day
+DECLARE_LOG_CATEGORY_EXTERN(LogFlareAI, Warning, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogFlareEconomy, Warning, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogFlareTravel, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogFlareCombat, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogFlareSave, Log, All);
+
+/** Number of subsystem log messages skipped because their category was muted */
+extern FThreadSafeCounter GFlareSuppressedLogCount;
+
+/** Log to a subsystem category, the arguments are not evaluated if the category is muted */
+#define FLOGC(Category, Format)  do \
+	{ \
+		if (Category.IsSuppressed(ELogVerbosity::Display)) \
+		{ \
+			GFlareSuppressedLogCount.Increment(); \
+		} \
+		else \
+		{ \
+			UE_LOG(Category, Display, TEXT(Format)); \
+		} \
+	} \
+	while (0)
+
+#define FLOGCV(Category, Format, ...)  do \
+	{ \
+		if (Category.IsSuppressed(ELogVerbosity::Display)) \
+		{ \
+			GFlareSuppressedLogCount.Increment(); \
+		} \
+		else \
+		{ \
+			UE_LOG(Category, Display, TEXT(Format), __VA_ARGS__); \
+		} \
+	} \
+	while (0)
+
 DECLARE_STATS_GROUP(TEXT("HeliumRain"), STATGROUP_Flare, STATCAT_Advanced);
 
 
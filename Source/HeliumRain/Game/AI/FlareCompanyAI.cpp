@@ -187,7 +187,7 @@ void UFlareCompanyAI::UpdateTrading()
 #ifdef DEBUG_AI_TRADING
 	if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 	{
-		FLOGV("UFlareCompanyAI::UpdateTrading : %s has %d idle ships", *Company->GetCompanyName().ToString(), IdleCargos.Num());
+		FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading : %s has %d idle ships", *Company->GetCompanyName().ToString(), IdleCargos.Num());
 	}
 #endif
 
@@ -213,7 +213,7 @@ void UFlareCompanyAI::UpdateTrading()
 	{
 		UFlareSimulatedSpacecraft* Ship = IdleCargos[ShipIndex];
 
-		//	FLOGV("UFlareCompanyAI::UpdateTrading : Search something to do for %s", *Ship->GetImmatriculation().ToString());
+		//	FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading : Search something to do for %s", *Ship->GetImmatriculation().ToString());
 		
 		SectorDeal BestDeal;
 		BestDeal.BuyQuantity = 0;
@@ -248,7 +248,7 @@ void UFlareCompanyAI::UpdateTrading()
 				SectorVariation* SectorVariationA = &WorldResourceVariation[SectorA];
 				if (Ship->GetCurrentSector() != SectorA && SectorVariationA->IncomingCapacity > 0 && SectorBestDeal.BuyQuantity > 0)
 				{
-					//FLOGV("UFlareCompanyAI::UpdateTrading : IncomingCapacity to %s = %d", *SectorA->GetSectorName().ToString(), SectorVariationA->IncomingCapacity);
+					//FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading : IncomingCapacity to %s = %d", *SectorA->GetSectorName().ToString(), SectorVariationA->IncomingCapacity);
 					int32 UsedIncomingCapacity = FMath::Min(SectorBestDeal.BuyQuantity, SectorVariationA->IncomingCapacity);
 
 					SectorVariationA->IncomingCapacity -= UsedIncomingCapacity;
@@ -272,9 +272,9 @@ void UFlareCompanyAI::UpdateTrading()
 #ifdef DEBUG_AI_TRADING
 			if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 			{
-				FLOGV("UFlareCompanyAI::UpdateTrading : Best balance for %s (%s) : %f score",
+				FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading : Best balance for %s (%s) : %f score",
 					*Ship->GetImmatriculation().ToString(), *Ship->GetCurrentSector()->GetSectorName().ToString(), BestDeal.Score / 100);
-				FLOGV("UFlareCompanyAI::UpdateTrading -> Transfer %s from %s to %s",
+				FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading -> Transfer %s from %s to %s",
 					*BestDeal.Resource->Name.ToString(), *BestDeal.SectorA->GetSectorName().ToString(), *BestDeal.SectorB->GetSectorName().ToString());
 			}
 #endif
@@ -290,7 +290,7 @@ void UFlareCompanyAI::UpdateTrading()
 #ifdef DEBUG_AI_TRADING
 						if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 						{
-							FLOGV("UFlareCompanyAI::UpdateTrading -> Travel to %s to sell", *BestDeal.SectorB->GetSectorName().ToString());
+							FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading -> Travel to %s to sell", *BestDeal.SectorB->GetSectorName().ToString());
 						}
 #endif
 					}
@@ -314,7 +314,7 @@ void UFlareCompanyAI::UpdateTrading()
 #ifdef DEBUG_AI_TRADING
 						if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 						{
-							FLOGV("UFlareCompanyAI::UpdateTrading -> Buy %d / %d to %s", BroughtResource, BestDeal.BuyQuantity, *StationCandidate->GetImmatriculation().ToString());
+							FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading -> Buy %d / %d to %s", BroughtResource, BestDeal.BuyQuantity, *StationCandidate->GetImmatriculation().ToString());
 						}
 #endif
 					}
@@ -367,7 +367,7 @@ void UFlareCompanyAI::UpdateTrading()
 #ifdef DEBUG_AI_TRADING
 					if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 					{
-						FLOGV("UFlareCompanyAI::UpdateTrading -> Travel to %s to buy", *BestDeal.SectorA->GetSectorName().ToString());
+						FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading -> Travel to %s to buy", *BestDeal.SectorA->GetSectorName().ToString());
 					}
 #endif
 				}
@@ -376,7 +376,7 @@ void UFlareCompanyAI::UpdateTrading()
 #ifdef DEBUG_AI_TRADING
 					if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 					{
-						FLOGV("UFlareCompanyAI::UpdateTrading -> Wait to %s", *BestDeal.SectorA->GetSectorName().ToString());
+						FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading -> Wait to %s", *BestDeal.SectorA->GetSectorName().ToString());
 					}
 #endif
 				}
@@ -406,7 +406,7 @@ void UFlareCompanyAI::UpdateTrading()
 #ifdef DEBUG_AI_TRADING
 					if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 					{
-						FLOGV("UFlareCompanyAI::UpdateTrading -> Sell %d / %d to %s", SellQuantity, Request.MaxQuantity, *StationCandidate->GetImmatriculation().ToString());
+						FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading -> Sell %d / %d to %s", SellQuantity, Request.MaxQuantity, *StationCandidate->GetImmatriculation().ToString());
 					}
 #endif
 				}
@@ -417,10 +417,10 @@ void UFlareCompanyAI::UpdateTrading()
 #ifdef DEBUG_AI_TRADING
 			if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 			{
-				FLOGV("UFlareCompanyAI::UpdateTrading : %s found nothing to do", *Ship->GetImmatriculation().ToString());
+				FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading : %s found nothing to do", *Ship->GetImmatriculation().ToString());
 			}
 #endif
-			//FLOGV("UFlareCompanyAI::UpdateTrading : HasProject ? %d ConstructionProjectNeedCapacity %d", (ConstructionProjectStationDescription != NULL), ConstructionProjectNeedCapacity);
+			//FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading : HasProject ? %d ConstructionProjectNeedCapacity %d", (ConstructionProjectStationDescription != NULL), ConstructionProjectNeedCapacity);
 
 			bool Usefull = false;
 
@@ -454,7 +454,7 @@ void UFlareCompanyAI::UpdateTrading()
 						}
 					}
 				}
-				//FLOGV("UFlareCompanyAI::UpdateTrading : %s add to construction", *Ship->GetImmatriculation().ToString());
+				//FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateTrading : %s add to construction", *Ship->GetImmatriculation().ToString());
 			}
 
 			if (!Usefull && Ship->GetCargoBay()->GetFreeSlotCount() > 0)
@@ -492,20 +492,20 @@ void UFlareCompanyAI::UpdateBestScore(float Score,
 									  UFlareSimulatedSpacecraft** BestStation,
 									  UFlareSimulatedSector** BestSector)
 {
-	//FLOGV("UpdateBestScore Score=%f BestScore=%f", Score, *BestScore);
+	//FLOGCV(LogFlareAI, "UpdateBestScore Score=%f BestScore=%f", Score, *BestScore);
 
 	// Update current construction score
 	if (ConstructionProjectSector == Sector &&
 			(Station ? ConstructionProjectStation == Station : ConstructionProjectStationDescription == StationDescription))
 	{
 		*CurrentConstructionScore = Score;
-		//FLOGV("Current : Score=%f", Score);
+		//FLOGCV(LogFlareAI, "Current : Score=%f", Score);
 	}
 
 	// Change best if we found better
 	if (Score > 0.f && (!BestStationDescription || Score > *BestScore))
 	{
-		//FLOGV("New Best : Score=%f", Score);
+		//FLOGCV(LogFlareAI, "New Best : Score=%f", Score);
 
 		*BestScore = Score;
 		*BestStationDescription = (Station ? Station->GetDescription() : StationDescription);
@@ -560,7 +560,7 @@ void UFlareCompanyAI::UpdateStationConstruction()
 			if(BuildSuccess)
 			{
 				// Build success clean contruction project
-				FLOGV("UFlareCompanyAI::UpdateStationConstruction %s build %s in %s", *Company->GetCompanyName().ToString(), *ConstructionProjectStationDescription->Name.ToString(), *ConstructionProjectSector->GetSectorName().ToString());
+				FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateStationConstruction %s build %s in %s", *Company->GetCompanyName().ToString(), *ConstructionProjectStationDescription->Name.ToString(), *ConstructionProjectSector->GetSectorName().ToString());
 
 				ClearConstructionProject();
 			}
@@ -582,7 +582,7 @@ void UFlareCompanyAI::UpdateStationConstruction()
 		else
 		{
 			// Abandon build project
-			FLOGV("UFlareCompanyAI::UpdateStationConstruction %s abandon building of %s in %s (upgrade: %d) : cannot build for strange reason", *Company->GetCompanyName().ToString(), *ConstructionProjectStationDescription->Name.ToString(), *ConstructionProjectSector->GetSectorName().ToString(), (ConstructionProjectStation != NULL));
+			FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateStationConstruction %s abandon building of %s in %s (upgrade: %d) : cannot build for strange reason", *Company->GetCompanyName().ToString(), *ConstructionProjectStationDescription->Name.ToString(), *ConstructionProjectSector->GetSectorName().ToString(), (ConstructionProjectStation != NULL));
 			if (ConstructionProjectStationDescription && ConstructionProjectSector)
 			{
 				float StationPrice = ComputeStationPrice(ConstructionProjectSector, ConstructionProjectStationDescription, ConstructionProjectStation);
@@ -801,7 +801,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 		ShipsInOtherSector.Remove(Ship);
 		ShipsToTravel.Remove(Ship);
 
-		FLOGV("Static Construction ship %s", *Ship->GetImmatriculation().ToString());
+		FLOGCV(LogFlareAI, "Static Construction ship %s", *Ship->GetImmatriculation().ToString());
 	}
 
 
@@ -812,7 +812,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 	{
 		UFlareSimulatedSpacecraft* Ship = ShipsInConstructionSector[ShipIndex];
 
-		FLOGV("Construction ship %s", *Ship->GetImmatriculation().ToString());
+		FLOGCV(LogFlareAI, "Construction ship %s", *Ship->GetImmatriculation().ToString());
 
 
 		// Give to others ships
@@ -828,7 +828,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 			FFlareResourceDescription* ResourceToGive = Cargo->Resource;
 			int32 QuantityToGive = Ship->GetCargoBay()->GetResourceQuantity(ResourceToGive, Ship->GetCompany());
 
-			FLOGV("  %d %s to give", QuantityToGive, *ResourceToGive->Name.ToString());
+			FLOGCV(LogFlareAI, "  %d %s to give", QuantityToGive, *ResourceToGive->Name.ToString());
 
 			for (int32 StaticShipIndex = 0; QuantityToGive > 0 && StaticShipIndex < ConstructionStaticShips.Num(); StaticShipIndex++)
 			{
@@ -846,7 +846,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 				QuantityToGive -= GivenQuantity;
 
 
-				FLOGV("  %d given to %s", QuantityToGive, *StaticShip->GetImmatriculation().ToString());
+				FLOGCV(LogFlareAI, "  %d given to %s", QuantityToGive, *StaticShip->GetImmatriculation().ToString());
 
 				if (QuantityToGive == 0)
 				{
@@ -877,7 +877,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 		for (int32 ShipIndex = 0; ShipIndex < ShipsToTravel.Num(); ShipIndex++)
 		{
 			UFlareSimulatedSpacecraft* Ship = ShipsToTravel[ShipIndex];
-			FLOGV("Construction ship %s to flush", *Ship->GetImmatriculation().ToString());
+			FLOGCV(LogFlareAI, "Construction ship %s to flush", *Ship->GetImmatriculation().ToString());
 
 			if (Ship->GetCargoBay()->GetUsedCargoSpace() > 0)
 			{
@@ -897,7 +897,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 		for (int32 ShipIndex = 0; ShipIndex < ShipsToTravel.Num(); ShipIndex++)
 		{
 			UFlareSimulatedSpacecraft* Ship = ShipsToTravel[ShipIndex];
-			FLOGV("Construction ship %s to travel", *Ship->GetImmatriculation().ToString());
+			FLOGCV(LogFlareAI, "Construction ship %s to travel", *Ship->GetImmatriculation().ToString());
 
 
 			TArray<FFlareResourceDescription*> MissingResources;
@@ -912,7 +912,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 				FFlareResourceDescription* MissingResource = MissingResources[ResourceIndex];
 				if (!MissingResourcesQuantity.Contains(MissingResource))
 				{
-					FLOGV("UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 0", *MissingResource->Name.ToString());
+					FLOGCV(LogFlareAI, "UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 0", *MissingResource->Name.ToString());
 				}
 				int32 MissingResourceQuantity = MissingResourcesQuantity[MissingResource];
 
@@ -936,7 +936,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 				if (StationCandidate)
 				{
 					TakenQuantity = SectorHelper::Trade(StationCandidate, Ship, MissingResource, Request.MaxQuantity);
-					FLOGV("  %d %s taken to %s", TakenQuantity, *MissingResource->Name.ToString(), *StationCandidate->GetImmatriculation().ToString());
+					FLOGCV(LogFlareAI, "  %d %s taken to %s", TakenQuantity, *MissingResource->Name.ToString(), *StationCandidate->GetImmatriculation().ToString());
 
 				}
 
@@ -949,7 +949,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 				{
 					if (!MissingResourcesQuantity.Contains(MissingResource))
 					{
-						FLOGV("UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 1", *MissingResource->Name.ToString());
+						FLOGCV(LogFlareAI, "UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 1", *MissingResource->Name.ToString());
 					}
 					MissingResourcesQuantity[MissingResource] = MissingResourceQuantity;
 				}
@@ -972,7 +972,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 			{
 				// Go to construction sector
 				Game->GetGameWorld()->StartTravel(Ship->GetCurrentFleet(), ConstructionProjectSector);
-				//FLOGV("  full, travel to %s", *ConstructionProjectSector->GetSectorName().ToString());
+				//FLOGCV(LogFlareAI, "  full, travel to %s", *ConstructionProjectSector->GetSectorName().ToString());
 			}
 			else
 			{
@@ -992,7 +992,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 
 					if (!WorldResourceVariation.Contains(Sector))
 					{
-						FLOGV("UFlareCompanyAI::FindResourcesForStationConstruction : !!! WorldResourceVariation doesn't contain %s", *Sector->GetSectorName().ToString());
+						FLOGCV(LogFlareAI, "UFlareCompanyAI::FindResourcesForStationConstruction : !!! WorldResourceVariation doesn't contain %s", *Sector->GetSectorName().ToString());
 					}
 					SectorVariation* SectorVariation = &WorldResourceVariation[Sector];
 					
@@ -1004,7 +1004,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 
 						int32 Stock = Variation->FactoryStock + Variation->OwnedStock + Variation->StorageStock;
 
-						//FLOGV("Stock in %s for %s : %d", *Sector->GetSectorName().ToString(), *MissingResource->Name.ToString(), Stock);
+						//FLOGCV(LogFlareAI, "Stock in %s for %s : %d", *Sector->GetSectorName().ToString(), *MissingResource->Name.ToString(), Stock);
 
 
 						if (Stock <= 0)
@@ -1015,7 +1015,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 						// Sector with missing ressource stock
 						if (!MissingResourcesQuantity.Contains(MissingResource))
 						{
-							FLOGV("UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 2", *MissingResource->Name.ToString());
+							FLOGCV(LogFlareAI, "UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 2", *MissingResource->Name.ToString());
 						}
 						int32 MissingResourceQuantity = MissingResourcesQuantity[MissingResource];
 						int32 Capacity = Ship->GetCargoBay()->GetFreeSpaceForResource(MissingResource, Ship->GetCompany());
@@ -1023,17 +1023,17 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 						float Score = FMath::Min(Stock, MissingResourceQuantity);
 						Score = FMath::Min(Score, (float)Capacity);
 
-						/*FLOGV("MissingResourceQuantity %d", MissingResourceQuantity);
-						FLOGV("Capacity %d", Capacity);
-						FLOGV("Score %d", Score);*/
+						/*FLOGCV(LogFlareAI, "MissingResourceQuantity %d", MissingResourceQuantity);
+						FLOGCV(LogFlareAI, "Capacity %d", Capacity);
+						FLOGCV(LogFlareAI, "Score %d", Score);*/
 
 						if (Score > 0 && (BestSector == NULL || BestScore < Score))
 						{
-							/*FLOGV("Best sector with stock %s for %s. Score = %f", *Sector->GetSectorName().ToString(), *MissingResource->Name.ToString(), Score);
-							FLOGV("Stock = %d",Stock);
-							FLOGV("Variation->FactoryStock = %d",Variation->FactoryStock);
-							FLOGV("Variation->OwnedStock = %d",Variation->OwnedStock);
-							FLOGV("Variation->StorageStock = %d",Variation->StorageStock);*/
+							/*FLOGCV(LogFlareAI, "Best sector with stock %s for %s. Score = %f", *Sector->GetSectorName().ToString(), *MissingResource->Name.ToString(), Score);
+							FLOGCV(LogFlareAI, "Stock = %d",Stock);
+							FLOGCV(LogFlareAI, "Variation->FactoryStock = %d",Variation->FactoryStock);
+							FLOGCV(LogFlareAI, "Variation->OwnedStock = %d",Variation->OwnedStock);
+							FLOGCV(LogFlareAI, "Variation->StorageStock = %d",Variation->StorageStock);*/
 
 							BestSector = Sector;
 							BestScore = Score;
@@ -1045,7 +1045,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 
 				if (!BestSector)
 				{
-					FLOG("no best sector");
+					FLOGC(LogFlareAI, "no best sector");
 					// Try a sector with a flow
 					for (int32 SectorIndex = 0; SectorIndex < Company->GetKnownSectors().Num(); SectorIndex++)
 					{
@@ -1064,7 +1064,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 							int32 Flow = Variation->FactoryFlow + Variation->OwnedFlow;
 
 
-							//FLOGV("Flow in %s for %s : %d", *Sector->GetSectorName().ToString(), *MissingResource->Name.ToString(), Flow);
+							//FLOGCV(LogFlareAI, "Flow in %s for %s : %d", *Sector->GetSectorName().ToString(), *MissingResource->Name.ToString(), Flow);
 
 
 							if (Flow >= 0)
@@ -1075,7 +1075,7 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 							// Sector with missing ressource stock
 							if (!MissingResourcesQuantity.Contains(MissingResource))
 							{
-								FLOGV("UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 3", *MissingResource->Name.ToString());
+								FLOGCV(LogFlareAI, "UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 3", *MissingResource->Name.ToString());
 							}
 							int32 MissingResourceQuantity = MissingResourcesQuantity[MissingResource];
 							int32 Capacity = Ship->GetCargoBay()->GetFreeSpaceForResource(MissingResource, Ship->GetCompany());
@@ -1087,17 +1087,17 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 
 
 
-							/*FLOGV("MissingResourceQuantity %d", MissingResourceQuantity);
-							FLOGV("Capacity %d", Capacity);
-							FLOGV("Score %f", Score);*/
+							/*FLOGCV(LogFlareAI, "MissingResourceQuantity %d", MissingResourceQuantity);
+							FLOGCV(LogFlareAI, "Capacity %d", Capacity);
+							FLOGCV(LogFlareAI, "Score %f", Score);*/
 
 
 							if (Score > 0 && (BestSector == NULL || BestScore < Score))
 							{
-								/*FLOGV("Best sector with flow %s for %s. Score = %f", *Sector->GetSectorName().ToString(), *MissingResource->Name.ToString(), Score);
-								FLOGV("Flow = %d",Flow);
-								FLOGV("Variation->FactoryFlow = %d",Variation->FactoryFlow);
-								FLOGV("Variation->OwnedFlow = %d",Variation->OwnedFlow);*/
+								/*FLOGCV(LogFlareAI, "Best sector with flow %s for %s. Score = %f", *Sector->GetSectorName().ToString(), *MissingResource->Name.ToString(), Score);
+								FLOGCV(LogFlareAI, "Flow = %d",Flow);
+								FLOGCV(LogFlareAI, "Variation->FactoryFlow = %d",Variation->FactoryFlow);
+								FLOGCV(LogFlareAI, "Variation->OwnedFlow = %d",Variation->OwnedFlow);*/
 
 
 								BestSector = Sector;
@@ -1113,12 +1113,12 @@ void UFlareCompanyAI::FindResourcesForStationConstruction()
 				{
 					// Travel to sector
 					Game->GetGameWorld()->StartTravel(Ship->GetCurrentFleet(), BestSector);
-					FLOGV("  travel to %s", *BestSector->GetSectorName().ToString());
+					FLOGCV(LogFlareAI, "  travel to %s", *BestSector->GetSectorName().ToString());
 
 					// Decrease missing quantity
 					if (!MissingResourcesQuantity.Contains(BestResource))
 					{
-						FLOGV("UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 4", *BestResource->Name.ToString());
+						FLOGCV(LogFlareAI, "UFlareCompanyAI::FindResourcesForStationConstruction : !!! MissingResourcesQuantity doesn't contain %s 4", *BestResource->Name.ToString());
 					}
 					MissingResourcesQuantity[BestResource] -= FMath::Max(0, BestEstimateTake);
 					SectorVariation* SectorVariation = &WorldResourceVariation[BestSector];
@@ -1140,7 +1140,7 @@ void UFlareCompanyAI::SpendBudget(EFlareBudget::Type Type, int64 Amount)
 
 
 #ifdef DEBUG_AI_BUDGET
-	FLOGV("%s spend %lld on %d", *Company->GetCompanyName().ToString(), Amount, (Type+0));
+	FLOGCV(LogFlareAI, "%s spend %lld on %d", *Company->GetCompanyName().ToString(), Amount, (Type+0));
 #endif
 	ModifyBudget(Type, -Amount);
 
@@ -1175,7 +1175,7 @@ int64 UFlareCompanyAI::GetBudget(EFlareBudget::Type Type)
 		break;
 	}
 #ifdef DEBUG_AI_BUDGET
-	FLOGV("GetBudget: unknown budget type %d", Type);
+	FLOGCV(LogFlareAI, "GetBudget: unknown budget type %d", Type);
 #endif
 	return 0;
 }
@@ -1187,30 +1187,30 @@ void UFlareCompanyAI::ModifyBudget(EFlareBudget::Type Type, int64 Amount)
 		case EFlareBudget::Military:
 			AIData.BudgetMilitary += Amount;
 #ifdef DEBUG_AI_BUDGET
-			FLOGV("New military budget %lld (%lld)", AIData.BudgetMilitary, Amount);
+			FLOGCV(LogFlareAI, "New military budget %lld (%lld)", AIData.BudgetMilitary, Amount);
 #endif
 		break;
 		case EFlareBudget::Station:
 			AIData.BudgetStation += Amount;
 #ifdef DEBUG_AI_BUDGET
-			FLOGV("New station budget %lld (%lld)", AIData.BudgetStation, Amount);
+			FLOGCV(LogFlareAI, "New station budget %lld (%lld)", AIData.BudgetStation, Amount);
 #endif
 		break;
 		case EFlareBudget::Technology:
 			AIData.BudgetTechnology += Amount;
 #ifdef DEBUG_AI_BUDGET
-			FLOGV("New technology budget %lld (%lld)", AIData.BudgetTechnology, Amount);
+			FLOGCV(LogFlareAI, "New technology budget %lld (%lld)", AIData.BudgetTechnology, Amount);
 #endif
 		break;
 		case EFlareBudget::Trade:
 			AIData.BudgetTrade += Amount;
 #ifdef DEBUG_AI_BUDGET
-			FLOGV("New trade budget %lld (%lld)", AIData.BudgetTrade, Amount);
+			FLOGCV(LogFlareAI, "New trade budget %lld (%lld)", AIData.BudgetTrade, Amount);
 #endif
 		break;
 #ifdef DEBUG_AI_BUDGET
 	default:
-			FLOGV("ModifyBudget: unknown budget type %d", Type);
+			FLOGCV(LogFlareAI, "ModifyBudget: unknown budget type %d", Type);
 #endif
 	}
 }
@@ -1219,7 +1219,7 @@ void UFlareCompanyAI::ProcessBudget(TArray<EFlareBudget::Type> BudgetToProcess)
 {
 	// Find
 #ifdef DEBUG_AI_BUDGET
-	FLOGV("Process budget for %s (%d projects)", *Company->GetCompanyName().ToString(), BudgetToProcess.Num());
+	FLOGCV(LogFlareAI, "Process budget for %s (%d projects)", *Company->GetCompanyName().ToString(), BudgetToProcess.Num());
 #endif
 
 	EFlareBudget::Type MaxBudgetType = EFlareBudget::None;
@@ -1241,7 +1241,7 @@ void UFlareCompanyAI::ProcessBudget(TArray<EFlareBudget::Type> BudgetToProcess)
 		return;
 	}
 #ifdef DEBUG_AI_BUDGET
-	FLOGV("max budget for %d with %lld", MaxBudgetType + 0, MaxBudgetAmount);
+	FLOGCV(LogFlareAI, "max budget for %d with %lld", MaxBudgetType + 0, MaxBudgetAmount);
 #endif
 
 	bool Lock = false;
@@ -1269,7 +1269,7 @@ void UFlareCompanyAI::ProcessBudget(TArray<EFlareBudget::Type> BudgetToProcess)
 	if(Lock)
 	{
 #ifdef DEBUG_AI_BUDGET
-		FLOG("Lock");
+		FLOGC(LogFlareAI, "Lock");
 #endif
 		// Process no other projets
 		return;
@@ -1278,7 +1278,7 @@ void UFlareCompanyAI::ProcessBudget(TArray<EFlareBudget::Type> BudgetToProcess)
 	if(Idle)
 	{
 #ifdef DEBUG_AI_BUDGET
-		FLOG("Idle");
+		FLOGC(LogFlareAI, "Idle");
 #endif
 		// Nothing to buy consume a part of its budget
 		SpendBudget(MaxBudgetType, MaxBudgetAmount / 100);
@@ -1362,7 +1362,7 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool& Lock, bool&
 	UFlareSimulatedSpacecraft* BestStation = NULL;
 	TArray<UFlareSpacecraftCatalogEntry*>& StationCatalog = Game->GetSpacecraftCatalog()->StationCatalog;
 #ifdef DEBUG_AI_BUDGET
-	FLOGV("UFlareCompanyAI::UpdateStationConstruction statics ships : %d construction ships : %d",
+	FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateStationConstruction statics ships : %d construction ships : %d",
 		  ConstructionStaticShips.Num(), ConstructionShips.Num());
 #endif
 
@@ -1389,7 +1389,7 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool& Lock, bool&
 				continue;
 			}
 
-			//FLOGV("> Analyse build %s in %s", *StationDescription->Name.ToString(), *Sector->GetSectorName().ToString());
+			//FLOGCV(LogFlareAI, "> Analyse build %s in %s", *StationDescription->Name.ToString(), *Sector->GetSectorName().ToString());
 
 			// Count factories for the company, compute rentability in each sector for each station
 			for (int32 FactoryIndex = 0; FactoryIndex < StationDescription->Factories.Num(); FactoryIndex++)
@@ -1419,7 +1419,7 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool& Lock, bool&
 				continue;
 			}
 
-			//FLOGV("> Analyse upgrade %s in %s", *Station->GetImmatriculation().ToString(), *Sector->GetSectorName().ToString());
+			//FLOGCV(LogFlareAI, "> Analyse upgrade %s in %s", *Station->GetImmatriculation().ToString(), *Sector->GetSectorName().ToString());
 
 			// Count factories for the company, compute rentability in each sector for each station
 			for (int32 FactoryIndex = 0; FactoryIndex < Station->GetDescription()->Factories.Num(); FactoryIndex++)
@@ -1455,7 +1455,7 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool& Lock, bool&
 	if (BestSector && BestStationDescription)
 	{
 #ifdef DEBUG_AI_BUDGET
-		FLOGV("UFlareCompanyAI::UpdateStationConstruction : %s >>> %s in %s (upgrade: %d) Score=%f", *Company->GetCompanyName().ToString(), *BestStationDescription->Name.ToString(), *BestSector->GetSectorName().ToString(), (BestStation != NULL),BestScore);
+		FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateStationConstruction : %s >>> %s in %s (upgrade: %d) Score=%f", *Company->GetCompanyName().ToString(), *BestStationDescription->Name.ToString(), *BestSector->GetSectorName().ToString(), (BestStation != NULL),BestScore);
 #endif
 		// Start construction only if can afford to buy the station
 
@@ -1466,7 +1466,7 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool& Lock, bool&
 		if (CurrentConstructionScore * 1.5 > BestScore)
 		{
 #ifdef DEBUG_AI_BUDGET
-			FLOGV("    dont change construction yet : current score is %f but best score is %f", CurrentConstructionScore, BestScore);
+			FLOGCV(LogFlareAI, "    dont change construction yet : current score is %f but best score is %f", CurrentConstructionScore, BestScore);
 #endif
 		}
 		else
@@ -1476,7 +1476,7 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool& Lock, bool&
 			{
 				StartConstruction = false;
 #ifdef DEBUG_AI_BUDGET
-				FLOGV("    dont build yet :station cost %f but company has only %lld", StationPrice, Company->GetMoney());
+				FLOGCV(LogFlareAI, "    dont build yet :station cost %f but company has only %lld", StationPrice, Company->GetMoney());
 #endif
 			}
 
@@ -1489,7 +1489,7 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool& Lock, bool&
 				IdleCargoCapacity -= NeedCapacity * 1.5; // Keep margin
 				StartConstruction = false;
 #ifdef DEBUG_AI_BUDGET
-				FLOGV("    dont build yet :station need %d idle capacity but company has only %d", NeedCapacity, IdleCargoCapacity);
+				FLOGCV(LogFlareAI, "    dont build yet :station need %d idle capacity but company has only %d", NeedCapacity, IdleCargoCapacity);
 #endif
 			}
 
@@ -1503,7 +1503,7 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool& Lock, bool&
 				}
 
 #ifdef DEBUG_AI_BUDGET
-				FLOG("Start construction");
+				FLOGC(LogFlareAI, "Start construction");
 #endif
 				ConstructionProjectStationDescription = BestStationDescription;
 				ConstructionProjectSector = BestSector;
@@ -1514,14 +1514,14 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool& Lock, bool&
 
 				SpendBudget(EFlareBudget::Station, StationPrice);
 #ifdef DEBUG_AI_BUDGET
-				FLOGV("  ConstructionProjectNeedCapacity = %d", ConstructionProjectNeedCapacity);
+				FLOGCV(LogFlareAI, "  ConstructionProjectNeedCapacity = %d", ConstructionProjectNeedCapacity);
 #endif
 				GameLog::AIConstructionStart(Company, ConstructionProjectSector, ConstructionProjectStationDescription, ConstructionProjectStation);
 			}
 			else if (ConstructionProjectStationDescription && ConstructionProjectSector)
 			{
 #ifdef DEBUG_AI_BUDGET
-				FLOGV("UFlareCompanyAI::UpdateStationConstruction %s abandon building of %s in %s (upgrade: %d) : want to change construction", *Company->GetCompanyName().ToString(), *ConstructionProjectStationDescription->Name.ToString(), *ConstructionProjectSector->GetSectorName().ToString(), (ConstructionProjectStation != NULL));
+				FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateStationConstruction %s abandon building of %s in %s (upgrade: %d) : want to change construction", *Company->GetCompanyName().ToString(), *ConstructionProjectStationDescription->Name.ToString(), *ConstructionProjectSector->GetSectorName().ToString(), (ConstructionProjectStation != NULL));
 #endif
 				ClearConstructionProject();
 				SpendBudget(EFlareBudget::Station, -StationPrice);
@@ -1586,7 +1586,7 @@ void UFlareCompanyAI::UpdateMilitaryMovement(bool DefendOnly)
 
 	TArray<UFlareSimulatedSpacecraft*> IdleMilitaryShips = FindIdleMilitaryShips();
 #ifdef DEBUG_AI_BUDGET
-	FLOGV("UpdateMilitaryMovement %d ships", IdleMilitaryShips.Num());
+	FLOGCV(LogFlareAI, "UpdateMilitaryMovement %d ships", IdleMilitaryShips.Num());
 #endif
 
 	for (int32 ShipIndex = 0; ShipIndex < IdleMilitaryShips.Num(); ShipIndex++)
@@ -1677,7 +1677,7 @@ int64 UFlareCompanyAI::OrderOneShip(FFlareSpacecraftDescription* ShipDescription
 				if (ShipPrice * CostSafetyMargin < CompanyMoney)
 				{
 					FName ShipClassToOrder = ShipDescription->Identifier;
-					FLOGV("UFlareCompanyAI::UpdateShipAcquisition : Ordering spacecraft : '%s'", *ShipClassToOrder.ToString());
+					FLOGCV(LogFlareAI, "UFlareCompanyAI::UpdateShipAcquisition : Ordering spacecraft : '%s'", *ShipClassToOrder.ToString());
 					Factory->OrderShip(Company, ShipClassToOrder);
 					Factory->Start();
 
@@ -1927,14 +1927,14 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 
 	/*if(StationDescription->Capabilities.Contains(EFlareSpacecraftCapability::Maintenance))
 	{
-		FLOGV(">>>>>Score for %s in %s", *StationDescription->Identifier.ToString(), *Sector->GetIdentifier().ToString());
+		FLOGCV(LogFlareAI, ">>>>>Score for %s in %s", *StationDescription->Identifier.ToString(), *Sector->GetIdentifier().ToString());
 	}*/
 
 
 	//TODO customer, maintenance and shipyard limit
 
 	Score *= Behavior->GetSectorAffility(Sector);
-	//FLOGV(" after sector Affility: %f", Score);
+	//FLOGCV(LogFlareAI, " after sector Affility: %f", Score);
 
 
 	if(StationDescription->Capabilities.Contains(EFlareSpacecraftCapability::Consumer))
@@ -1952,10 +1952,10 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 
 
 			float Consumption = Sector->GetPeople()->GetRessourceConsumption(Resource, false);
-			//FLOGV("%s comsumption = %f", *Resource->Name.ToString(), Consumption);
+			//FLOGCV(LogFlareAI, "%s comsumption = %f", *Resource->Name.ToString(), Consumption);
 
 			float ReserveStock =  Variation->ConsumerMaxStock / 10.f;
-			//FLOGV("ReserveStock = %f", ReserveStock);
+			//FLOGCV(LogFlareAI, "ReserveStock = %f", ReserveStock);
 			if (Consumption < ReserveStock)
 			{
 				float ScoreModifier = 2.f * ((Consumption / ReserveStock) - 0.5);
@@ -1974,7 +1974,7 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 		Score *= MaxScoreModifier;
 		float StationPrice = ComputeStationPrice(Sector, StationDescription, Station);
 		Score *= 1.f + 1/StationPrice;
-		//FLOGV("MaxScoreModifier = %f", MaxScoreModifier);
+		//FLOGCV(LogFlareAI, "MaxScoreModifier = %f", MaxScoreModifier);
 	}
 	else if(StationDescription->Capabilities.Contains(EFlareSpacecraftCapability::Maintenance))
 	{
@@ -1991,10 +1991,10 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 
 
 			int32 Consumption = Sector->GetPeople()->GetBasePopulation() / 10;
-			//FLOGV("%s comsumption = %d", *Resource->Name.ToString(), Consumption);
+			//FLOGCV(LogFlareAI, "%s comsumption = %d", *Resource->Name.ToString(), Consumption);
 
 			float ReserveStock =  Variation->MaintenanceMaxStock;
-			//FLOGV("ReserveStock = %f", ReserveStock);
+			//FLOGCV(LogFlareAI, "ReserveStock = %f", ReserveStock);
 			if (Consumption < ReserveStock)
 			{
 				float ScoreModifier = 2.f * ((Consumption / ReserveStock) - 0.5);
@@ -2012,7 +2012,7 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 			// If superior, keep 1
 		}
 		Score *= MaxScoreModifier;
-		//FLOGV("MaxScoreModifier = %f", MaxScoreModifier);
+		//FLOGCV(LogFlareAI, "MaxScoreModifier = %f", MaxScoreModifier);
 
 		float StationPrice = ComputeStationPrice(Sector, StationDescription, Station);
 		Score *= 1.f + 1/StationPrice;
@@ -2046,9 +2046,9 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 				{
 					float UnderflowMalus = FMath::Clamp((UnderflowRatio * 100)  / 20.f + 1.f, 0.f, 1.f);
 					Score *= UnderflowMalus;
-					//FLOGV("    MaxVolume %f", MaxVolume);
-					//FLOGV("    UnderflowRatio %f", UnderflowRatio);
-					//FLOGV("    UnderflowMalus %f", UnderflowMalus);
+					//FLOGCV(LogFlareAI, "    MaxVolume %f", MaxVolume);
+					//FLOGCV(LogFlareAI, "    UnderflowRatio %f", UnderflowRatio);
+					//FLOGCV(LogFlareAI, "    UnderflowMalus %f", UnderflowMalus);
 				}
 			}
 			else
@@ -2063,7 +2063,7 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 			Score *= (1 - PriceRatio) * 2;
 		}
 
-		//FLOGV(" after input: %f", Score);
+		//FLOGCV(LogFlareAI, " after input: %f", Score);
 
 		if(Score == 0)
 		{
@@ -2079,7 +2079,7 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 			Score *= ResourceAffility;
 
 
-			//FLOGV(" ResourceAffility for %s: %f", *Resource->Resource->Data.Identifier.ToString(), ResourceAffility);
+			//FLOGCV(LogFlareAI, " ResourceAffility for %s: %f", *Resource->Resource->Data.Identifier.ToString(), ResourceAffility);
 
 			float MaxVolume = FMath::Max(WorldStats[&Resource->Resource->Data].Production, WorldStats[&Resource->Resource->Data].Consumption);
 			if(MaxVolume > 0)
@@ -2089,9 +2089,9 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 				{
 					float OverflowMalus = FMath::Clamp(1.f - (OverflowRatio * 100)  / ResourceAffility, 0.f, 1.f);
 					Score *= OverflowMalus;
-					//FLOGV("    MaxVolume %f", MaxVolume);
-					//FLOGV("    OverflowRatio %f", OverflowRatio);
-					//FLOGV("    OverflowMalus %f", OverflowMalus);
+					//FLOGCV(LogFlareAI, "    MaxVolume %f", MaxVolume);
+					//FLOGCV(LogFlareAI, "    OverflowRatio %f", OverflowRatio);
+					//FLOGCV(LogFlareAI, "    OverflowMalus %f", OverflowMalus);
 				}
 			}
 
@@ -2099,13 +2099,13 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 			float PriceRatio = (ResourcePrice - (float) Resource->Resource->Data.MinPrice) / (float) (Resource->Resource->Data.MaxPrice - Resource->Resource->Data.MinPrice);
 
 
-			//FLOGV("    PriceRatio %f", PriceRatio);
+			//FLOGCV(LogFlareAI, "    PriceRatio %f", PriceRatio);
 
 
 			Score *= PriceRatio * 2;
 		}
 
-		//FLOGV(" after output: %f", Score);
+		//FLOGCV(LogFlareAI, " after output: %f", Score);
 
 		float GainPerDay = GainPerCycle / FactoryDescription->CycleCost.ProductionTime;
 		if(GainPerDay < 0)
@@ -2127,18 +2127,18 @@ float UFlareCompanyAI::ComputeConstructionScoreForStation(UFlareSimulatedSector*
 		return 0;
 	}
 
-	//FLOGV(" GainPerCycle: %f", GainPerCycle);
-	//FLOGV(" GainPerDay: %f", GainPerDay);
-	//FLOGV(" StationPrice: %f", StationPrice);
-	//FLOGV(" DayToPayPrice: %f", DayToPayPrice);
-	//FLOGV(" PaybackMalus: %f", PaybackMalus);
+	//FLOGCV(LogFlareAI, " GainPerCycle: %f", GainPerCycle);
+	//FLOGCV(LogFlareAI, " GainPerDay: %f", GainPerDay);
+	//FLOGCV(LogFlareAI, " StationPrice: %f", StationPrice);
+	//FLOGCV(LogFlareAI, " DayToPayPrice: %f", DayToPayPrice);
+	//FLOGCV(LogFlareAI, " PaybackMalus: %f", PaybackMalus);
 
 	/*if(StationDescription->Capabilities.Contains(EFlareSpacecraftCapability::Consumer) ||
 			StationDescription->Capabilities.Contains(EFlareSpacecraftCapability::Maintenance) ||
 			StationDescription->Capabilities.Contains(EFlareSpacecraftCapability::Storage)
 			)
 	{
-	FLOGV("Score=%f for %s in %s", Score, *StationDescription->Identifier.ToString(), *Sector->GetIdentifier().ToString());
+	FLOGCV(LogFlareAI, "Score=%f for %s in %s", Score, *StationDescription->Identifier.ToString(), *Sector->GetIdentifier().ToString());
 	}*/
 
 	return Score;
@@ -2517,7 +2517,7 @@ SectorVariation UFlareCompanyAI::ComputeSectorResourceVariation(UFlareSimulatedS
 
 void UFlareCompanyAI::DumpSectorResourceVariation(UFlareSimulatedSector* Sector, TMap<FFlareResourceDescription*, struct ResourceVariation>* SectorVariation) const
 {
-	FLOGV("DumpSectorResourceVariation : sector %s resource variation: ", *Sector->GetSectorName().ToString());
+	FLOGCV(LogFlareAI, "DumpSectorResourceVariation : sector %s resource variation: ", *Sector->GetSectorName().ToString());
 	for(int32 ResourceIndex = 0; ResourceIndex < Game->GetResourceCatalog()->Resources.Num(); ResourceIndex++)
 	{
 		FFlareResourceDescription* Resource = &Game->GetResourceCatalog()->Resources[ResourceIndex]->Data;
@@ -2533,25 +2533,25 @@ void UFlareCompanyAI::DumpSectorResourceVariation(UFlareSimulatedSector* Sector,
 				Variation->MaintenanceCapacity
 				)
 		{
-			FLOGV(" - Resource %s", *Resource->Name.ToString());
+			FLOGCV(LogFlareAI, " - Resource %s", *Resource->Name.ToString());
 			if (Variation->OwnedFlow)
-				FLOGV("   owned flow %d / day", Variation->OwnedFlow);
+				FLOGCV(LogFlareAI, "   owned flow %d / day", Variation->OwnedFlow);
 			if (Variation->FactoryFlow)
-				FLOGV("   factory flow %d / day", Variation->FactoryFlow);
+				FLOGCV(LogFlareAI, "   factory flow %d / day", Variation->FactoryFlow);
 			if (Variation->OwnedStock)
-				FLOGV("   owned stock %d", Variation->OwnedStock);
+				FLOGCV(LogFlareAI, "   owned stock %d", Variation->OwnedStock);
 			if (Variation->FactoryStock)
-				FLOGV("   factory stock %d", Variation->FactoryStock);
+				FLOGCV(LogFlareAI, "   factory stock %d", Variation->FactoryStock);
 			if (Variation->StorageStock)
-				FLOGV("   storage stock %d", Variation->StorageStock);
+				FLOGCV(LogFlareAI, "   storage stock %d", Variation->StorageStock);
 			if (Variation->OwnedCapacity)
-				FLOGV("   owned capacity %d", Variation->OwnedCapacity);
+				FLOGCV(LogFlareAI, "   owned capacity %d", Variation->OwnedCapacity);
 			if (Variation->FactoryCapacity)
-				FLOGV("   factory capacity %d", Variation->FactoryCapacity);
+				FLOGCV(LogFlareAI, "   factory capacity %d", Variation->FactoryCapacity);
 			if (Variation->StorageCapacity)
-				FLOGV("   storage capacity %d", Variation->StorageCapacity);
+				FLOGCV(LogFlareAI, "   storage capacity %d", Variation->StorageCapacity);
 			if (Variation->MaintenanceCapacity)
-				FLOGV("   maintenance capacity %d", Variation->MaintenanceCapacity);
+				FLOGCV(LogFlareAI, "   maintenance capacity %d", Variation->MaintenanceCapacity);
 		}
 
 	}
@@ -2607,7 +2607,7 @@ SectorDeal UFlareCompanyAI::FindBestDealForShipFromSector(UFlareSimulatedSpacecr
 
 		if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 		{
-			FLOGV("Travel %s -> %s -> %s : %lld days", *Ship->GetCurrentSector()->GetSectorName().ToString(),
+			FLOGCV(LogFlareAI, "Travel %s -> %s -> %s : %lld days", *Ship->GetCurrentSector()->GetSectorName().ToString(),
 			*SectorA->GetSectorName().ToString(), *SectorB->GetSectorName().ToString(), TravelTime);
 		}
 #endif
@@ -2624,7 +2624,7 @@ SectorDeal UFlareCompanyAI::FindBestDealForShipFromSector(UFlareSimulatedSpacecr
 #ifdef DEBUG_AI_TRADING
 		if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 		{
-			FLOGV("- Check for %s", *Resource->Name.ToString());
+			FLOGCV(LogFlareAI, "- Check for %s", *Resource->Name.ToString());
 		}
 
 		/*if(Resource->Identifier != "fuel")
@@ -2791,25 +2791,25 @@ SectorDeal UFlareCompanyAI::FindBestDealForShipFromSector(UFlareSimulatedSpacecr
 #ifdef DEBUG_AI_TRADING
 			if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 			{
-				FLOGV(" -> IncomingCapacity=%d", SectorVariationA->IncomingCapacity);
-				FLOGV(" -> IncomingResources=%d", VariationA->IncomingResources);
-				FLOGV(" -> InitialQuantity=%d", InitialQuantity);
-				FLOGV(" -> FreeSpace=%d", FreeSpace);
-				FLOGV(" -> StockInAAfterTravel=%d", StockInAAfterTravel);
-				FLOGV(" -> BuyQuantity=%d", BuyQuantity);
-				FLOGV(" -> CapacityInBAfterTravel=%d", CapacityInBAfterTravel);
-				FLOGV(" -> SellQuantity=%u", SellQuantity);
-				FLOGV(" -> MoneyGain=%f", MoneyGain/100.f);
-				FLOGV(" -> MoneySpend=%f", MoneySpend/100.f);
-				FLOGV("   -> OwnedBuyQuantity=%d", OwnedBuyQuantity);
-				FLOGV("   -> FactoryBuyQuantity=%d", FactoryBuyQuantity);
-				FLOGV("   -> StorageBuyQuantity=%d", StorageBuyQuantity);
-				FLOGV(" -> MoneyBalance=%f", MoneyBalance/100.f);
-				FLOGV(" -> MoneyBalanceParDay=%f", MoneyBalanceParDay/100.f);
-				FLOGV(" -> Resource affility=%f", Behavior->GetResourceAffility(Resource));
-				FLOGV(" -> SectorA affility=%f", Behavior->GetSectorAffility(SectorA));
-				FLOGV(" -> SectorB affility=%f", Behavior->GetSectorAffility(SectorB));
-				FLOGV(" -> Score=%f", Score);
+				FLOGCV(LogFlareAI, " -> IncomingCapacity=%d", SectorVariationA->IncomingCapacity);
+				FLOGCV(LogFlareAI, " -> IncomingResources=%d", VariationA->IncomingResources);
+				FLOGCV(LogFlareAI, " -> InitialQuantity=%d", InitialQuantity);
+				FLOGCV(LogFlareAI, " -> FreeSpace=%d", FreeSpace);
+				FLOGCV(LogFlareAI, " -> StockInAAfterTravel=%d", StockInAAfterTravel);
+				FLOGCV(LogFlareAI, " -> BuyQuantity=%d", BuyQuantity);
+				FLOGCV(LogFlareAI, " -> CapacityInBAfterTravel=%d", CapacityInBAfterTravel);
+				FLOGCV(LogFlareAI, " -> SellQuantity=%u", SellQuantity);
+				FLOGCV(LogFlareAI, " -> MoneyGain=%f", MoneyGain/100.f);
+				FLOGCV(LogFlareAI, " -> MoneySpend=%f", MoneySpend/100.f);
+				FLOGCV(LogFlareAI, "   -> OwnedBuyQuantity=%d", OwnedBuyQuantity);
+				FLOGCV(LogFlareAI, "   -> FactoryBuyQuantity=%d", FactoryBuyQuantity);
+				FLOGCV(LogFlareAI, "   -> StorageBuyQuantity=%d", StorageBuyQuantity);
+				FLOGCV(LogFlareAI, " -> MoneyBalance=%f", MoneyBalance/100.f);
+				FLOGCV(LogFlareAI, " -> MoneyBalanceParDay=%f", MoneyBalanceParDay/100.f);
+				FLOGCV(LogFlareAI, " -> Resource affility=%f", Behavior->GetResourceAffility(Resource));
+				FLOGCV(LogFlareAI, " -> SectorA affility=%f", Behavior->GetSectorAffility(SectorA));
+				FLOGCV(LogFlareAI, " -> SectorB affility=%f", Behavior->GetSectorAffility(SectorB));
+				FLOGCV(LogFlareAI, " -> Score=%f", Score);
 			}
 #endif
 
@@ -2824,31 +2824,31 @@ SectorDeal UFlareCompanyAI::FindBestDealForShipFromSector(UFlareSimulatedSpacecr
 #ifdef DEBUG_AI_TRADING
 				if(Company->GetShortName() == DEBUG_AI_TRADING_COMPANY)
 				{
-					//FLOGV("Travel %s -> %s -> %s : %lld days", *Ship->GetCurrentSector()->GetSectorName().ToString(),
+					//FLOGCV(LogFlareAI, "Travel %s -> %s -> %s : %lld days", *Ship->GetCurrentSector()->GetSectorName().ToString(),
 					//*SectorA->GetSectorName().ToString(), *SectorB->GetSectorName().ToString(), TravelTime);
 
-					FLOGV("New Best Resource %s", *Resource->Name.ToString())
-
-
-				/*	FLOGV(" -> IncomingCapacity=%d", SectorVariationA->IncomingCapacity);
-					FLOGV(" -> IncomingResources=%d", VariationA->IncomingResources);
-					FLOGV(" -> InitialQuantity=%d", InitialQuantity);
-					FLOGV(" -> FreeSpace=%d", FreeSpace);
-					FLOGV(" -> StockInAAfterTravel=%d", StockInAAfterTravel);
-					FLOGV(" -> BuyQuantity=%d", BuyQuantity);
-					FLOGV(" -> CapacityInBAfterTravel=%d", CapacityInBAfterTravel);
-					FLOGV(" -> SellQuantity=%u", SellQuantity);
-					FLOGV(" -> MoneyGain=%f", MoneyGain/100.f);
-					FLOGV(" -> MoneySpend=%f", MoneySpend/100.f);
-					FLOGV("   -> OwnedBuyQuantity=%d", OwnedBuyQuantity);
-					FLOGV("   -> FactoryBuyQuantity=%d", FactoryBuyQuantity);
-					FLOGV("   -> StorageBuyQuantity=%d", StorageBuyQuantity);
-					FLOGV(" -> MoneyBalance=%f", MoneyBalance/100.f);
-					FLOGV(" -> MoneyBalanceParDay=%f", MoneyBalanceParDay/100.f);
-					FLOGV(" -> Resource affility=%f", Behavior->GetResourceAffility(Resource));
-					FLOGV(" -> SectorA affility=%f", Behavior->GetSectorAffility(SectorA));
-					FLOGV(" -> SectorB affility=%f", Behavior->GetSectorAffility(SectorB));*/
-					//FLOGV(" -> Score=%f", Score);
+					FLOGCV(LogFlareAI, "New Best Resource %s", *Resource->Name.ToString());
+
+
+				/*	FLOGCV(LogFlareAI, " -> IncomingCapacity=%d", SectorVariationA->IncomingCapacity);
+					FLOGCV(LogFlareAI, " -> IncomingResources=%d", VariationA->IncomingResources);
+					FLOGCV(LogFlareAI, " -> InitialQuantity=%d", InitialQuantity);
+					FLOGCV(LogFlareAI, " -> FreeSpace=%d", FreeSpace);
+					FLOGCV(LogFlareAI, " -> StockInAAfterTravel=%d", StockInAAfterTravel);
+					FLOGCV(LogFlareAI, " -> BuyQuantity=%d", BuyQuantity);
+					FLOGCV(LogFlareAI, " -> CapacityInBAfterTravel=%d", CapacityInBAfterTravel);
+					FLOGCV(LogFlareAI, " -> SellQuantity=%u", SellQuantity);
+					FLOGCV(LogFlareAI, " -> MoneyGain=%f", MoneyGain/100.f);
+					FLOGCV(LogFlareAI, " -> MoneySpend=%f", MoneySpend/100.f);
+					FLOGCV(LogFlareAI, "   -> OwnedBuyQuantity=%d", OwnedBuyQuantity);
+					FLOGCV(LogFlareAI, "   -> FactoryBuyQuantity=%d", FactoryBuyQuantity);
+					FLOGCV(LogFlareAI, "   -> StorageBuyQuantity=%d", StorageBuyQuantity);
+					FLOGCV(LogFlareAI, " -> MoneyBalance=%f", MoneyBalance/100.f);
+					FLOGCV(LogFlareAI, " -> MoneyBalanceParDay=%f", MoneyBalanceParDay/100.f);
+					FLOGCV(LogFlareAI, " -> Resource affility=%f", Behavior->GetResourceAffility(Resource));
+					FLOGCV(LogFlareAI, " -> SectorA affility=%f", Behavior->GetSectorAffility(SectorA));
+					FLOGCV(LogFlareAI, " -> SectorB affility=%f", Behavior->GetSectorAffility(SectorB));*/
+					//FLOGCV(LogFlareAI, " -> Score=%f", Score);
 				}
 #endif
 			}
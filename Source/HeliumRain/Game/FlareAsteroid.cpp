@@ -120,6 +120,32 @@ FFlareAsteroidSave* AFlareAsteroid::Save()
 	return &AsteroidData;
 }
 
+void AFlareAsteroid::PrepareForRecycling()
+{
+	Asteroid->SetSimulatePhysics(false);
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+	SetActorTickEnabled(false);
+}
+
+void AFlareAsteroid::RecycleAt(FVector Location, FRotator Rotation)
+{
+	SetActorLocationAndRotation(Location, Rotation, false, NULL, ETeleportType::TeleportPhysics);
+
+	Paused = false;
+	CustomTimeDilation = 1.0;
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+	Asteroid->SetSimulatePhysics(true);
+
+	AFlareGame* Game = Cast<AFlareGame>(GetWorld()->GetAuthGameMode());
+	if (Game && Game->GetActiveSector())
+	{
+		Asteroid->SetIcy(Game->GetActiveSector()->GetSimulatedSector()->GetDescription()->IsIcy);
+	}
+}
+
 void AFlareAsteroid::SetPause(bool Pause)
 {
 	if (Paused == Pause)
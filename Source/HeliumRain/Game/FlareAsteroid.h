@@ -36,6 +36,12 @@ public:
 	/** Set as paused */
 	virtual void SetPause(bool Paused);
 
+	/** Deactivate the asteroid so that it can be loaded again in another sector */
+	virtual void PrepareForRecycling();
+
+	/** Reactivate a recycled asteroid at a new location, before loading it */
+	virtual void RecycleAt(FVector Location, FRotator Rotation);
+
 	/** Setup an asteroid mesh */
 	static void SetupAsteroidMesh(AFlareGame* Game, UStaticMeshComponent* Component, const FFlareAsteroidSave& Data, bool IsIcy);
 
@@ -6,6 +6,18 @@
 #include "FlareGame.h"
 #include "FlareGameTools.h"
 
+
+DECLARE_CYCLE_STAT(TEXT("FlareBattle Simulate"), STAT_FlareBattle_Simulate, STATGROUP_Flare);
+
+#define BATTLE_STATE_LARGE            0x01
+#define BATTLE_STATE_SMALL            0x02
+#define BATTLE_STATE_STATION          0x04
+#define BATTLE_STATE_MILITARY         0x08
+#define BATTLE_STATE_DANGEROUS        0x10
+#define BATTLE_STATE_STRANDED         0x20
+#define BATTLE_STATE_UNCONTROLLABLE   0x40
+#define BATTLE_STATE_HARPOONED        0x80
+
 struct BattleTargetPreferences
 {
         float IsLarge;
@@ -31,7 +43,12 @@ struct BattleTargetPreferences
 
 UFlareBattle::UFlareBattle(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, TurnCount(0)
+	, UseLegacyResolver(false)
+	, HostilityVersion(-1)
+	, StateWeightStamp(0)
 {
+	FMemory::Memzero(StateWeightStamps, sizeof(StateWeightStamps));
 }
 
 void UFlareBattle::Load(UFlareSimulatedSector* BattleSector)
@@ -50,21 +67,28 @@ void UFlareBattle::Load(UFlareSimulatedSector* BattleSector)
 
 void UFlareBattle::Simulate()
 {
-    int32 BattleTurn = 0;
+	SCOPE_CYCLE_COUNTER(STAT_FlareBattle_Simulate);
+    TurnCount = 0;
 
-    FLOGV("Simulate battle in %s", *Sector->GetSectorName().ToString());
+    FLOGCV(LogFlareCombat, "Simulate battle in %s", *Sector->GetSectorName().ToString());
 
 	CombatLog::AutomaticBattleStarted(Sector);
 
+	if (!UseLegacyResolver)
+	{
+		BuildTargetTables();
+	}
+
 	while (HasBattle())
     {
-        BattleTurn++;
-		if(!SimulateTurn())
+        TurnCount++;
+		bool HasFight = (UseLegacyResolver ? SimulateTurn() : SimulateCachedTurn());
+		if(!HasFight)
         {
-            FLOG("Nobody can fight, end battle");
+            FLOGC(LogFlareCombat, "Nobody can fight, end battle");
             break;
         }
-        if (BattleTurn > 1000)
+        if (TurnCount > 1000)
         {
             FLOG("ERROR: Battle too long, still not ended after 1000 turns");
             break;
@@ -72,7 +96,12 @@ void UFlareBattle::Simulate()
     }
 
 	CombatLog::AutomaticBattleEnded(Sector);
-    FLOGV("Battle in %s finish after %d turns", *Sector->GetSectorName().ToString(), BattleTurn);
+    FLOGCV(LogFlareCombat, "Battle in %s finish after %d turns", *Sector->GetSectorName().ToString(), TurnCount);
+}
+
+void UFlareBattle::SetLegacyResolver(bool Legacy)
+{
+	UseLegacyResolver = Legacy;
 }
 
 bool UFlareBattle::HasBattle()
@@ -222,10 +251,10 @@ bool UFlareBattle::SimulateSmallShipTurn(UFlareSimulatedSpacecraft* Ship)
 		return false;
 	}
 
-	FLOGV("%s want to attack %s with %s",
+	FLOGCV(LogFlareCombat, "%s want to attack %s with %s",
 		  *Ship->GetImmatriculation().ToString(),
 		  *Target->GetImmatriculation().ToString(),
-		  *Ship->GetWeaponsSystem()->GetWeaponGroup(WeaponGroupIndex)->Description->Identifier.ToString())
+		  *Ship->GetWeaponsSystem()->GetWeaponGroup(WeaponGroupIndex)->Description->Identifier.ToString());
 
 
 	return SimulateShipAttack(Ship, WeaponGroupIndex, Target);
@@ -294,10 +323,10 @@ bool UFlareBattle::SimulateLargeShipTurn(UFlareSimulatedSpacecraft* Ship)
 			return false;
 		}
 
-		FLOGV("%s want to attack %s with %s",
+		FLOGCV(LogFlareCombat, "%s want to attack %s with %s",
 			  *Ship->GetImmatriculation().ToString(),
 			  *Target->GetImmatriculation().ToString(),
-			  *ComponentData->ShipSlotIdentifier.ToString())
+			  *ComponentData->ShipSlotIdentifier.ToString());
 
 
 		if (SimulateShipWeaponAttack(Ship, ComponentDescription, ComponentData, Target))
@@ -310,10 +339,15 @@ bool UFlareBattle::SimulateLargeShipTurn(UFlareSimulatedSpacecraft* Ship)
 
 UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft* Ship, struct BattleTargetPreferences Preferences)
 {
+	if (!UseLegacyResolver)
+	{
+		return GetBestCachedTarget(Ship, Preferences);
+	}
+
 	UFlareSimulatedSpacecraft* BestTarget = NULL;
 	float BestScore = 0;
 
-	//FLOGV("GetBestTarget for %s", *Ship->GetImmatriculation().ToString());
+	//FLOGCV(LogFlareCombat, "GetBestTarget for %s", *Ship->GetImmatriculation().ToString());
 
 	for (int32 SpacecraftIndex = 0 ; SpacecraftIndex < Sector->GetSectorSpacecrafts().Num(); SpacecraftIndex++)
 	{
@@ -509,7 +543,7 @@ bool UFlareBattle::SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFl
 
 		float Precision = UsageRatio * FMath::Max(0.01f, 1.f-(WeaponDescription->WeaponCharacteristics.GunCharacteristics.AmmoPrecision * TargetCoef));
 
-		FLOGV("Fire %d ammo with a hit probability of %f", AmmoToFire, Precision);
+		FLOGCV(LogFlareCombat, "Fire %d ammo with a hit probability of %f", AmmoToFire, Precision);
 		for (int32 BulletIndex = 0; BulletIndex <  AmmoToFire; BulletIndex++)
 		{
 			if(FMath::FRand() < Precision)
@@ -521,6 +555,7 @@ bool UFlareBattle::SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFl
 
 		Weapon->Weapon.FiredAmmo += AmmoToFire;
 		Target->GetDamageSystem()->SetAmmoDirty();
+		Ship->SetDirty();
 	}
 	else if(WeaponDescription->WeaponCharacteristics.BombCharacteristics.IsBomb && CurrentAmmo > 0)
 	{
@@ -534,6 +569,7 @@ bool UFlareBattle::SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFl
 
 		Weapon->Weapon.FiredAmmo++;
 		Target->GetDamageSystem()->SetAmmoDirty();
+		Ship->SetDirty();
 	}
 	else
 	{
@@ -541,6 +577,10 @@ bool UFlareBattle::SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFl
 		return false;
 	}
 
+	// Both ships may have lost weapons, engines or ammo
+	UpdateTarget(Target);
+	UpdateTarget(Ship);
+
 	return true;
 }
 
@@ -581,7 +621,7 @@ void UFlareBattle::SimulateBombDamage(FFlareSpacecraftComponentDescription* Weap
 		((WeaponDescription->WeaponCharacteristics.DamageType == EFlareShellDamageType::LightSalvage && Target->GetDescription()->Size == EFlarePartSize::S)
 	 || (WeaponDescription->WeaponCharacteristics.DamageType == EFlareShellDamageType::HeavySalvage && Target->GetDescription()->Size == EFlarePartSize::L)))
 	{
-		FLOGV("UFlareBattle::SimulateBombDamage : salvaging %s for %s", *Target->GetImmatriculation().ToString(), *DamageSource->GetCompanyName().ToString());
+		FLOGCV(LogFlareCombat, "UFlareBattle::SimulateBombDamage : salvaging %s for %s", *Target->GetImmatriculation().ToString(), *DamageSource->GetCompanyName().ToString());
 		Target->SetHarpooned(DamageSource);
 	}
 }
@@ -703,4 +743,246 @@ int32 UFlareBattle::GetBestTargetComponent(UFlareSimulatedSpacecraft* TargetSpac
 }
 
 
+/*----------------------------------------------------
+	Target tables
+----------------------------------------------------*/
+
+void UFlareBattle::BuildTargetTables()
+{
+	const TArray<UFlareSimulatedSpacecraft*>& Spacecrafts = Sector->GetSectorSpacecrafts();
+
+	Targets.Empty(Spacecrafts.Num());
+	TargetIndices.Empty(Spacecrafts.Num());
+	Companies.Empty();
+	HostileTargets.Empty();
+	HostilityVersion = Game->GetGameWorld()->GetHostilityVersion();
+
+	// Snapshot the spacecraft once, ships in reserve never fight nor get targeted
+	for (int32 SpacecraftIndex = 0; SpacecraftIndex < Spacecrafts.Num(); SpacecraftIndex++)
+	{
+		UFlareSimulatedSpacecraft* Spacecraft = Spacecrafts[SpacecraftIndex];
+
+		if (Spacecraft->IsReserve())
+		{
+			continue;
+		}
+
+		FFlareBattleTarget Target;
+		Target.Spacecraft = Spacecraft;
+		Target.CompanyIndex = Companies.AddUnique(Spacecraft->GetCompany());
+		Target.StateKey = 0;
+		Target.Eligible = false;
+		Target.Fighter = !Spacecraft->IsStation() && Spacecraft->IsMilitary();
+		Target.Disarmed = true;
+
+		TargetIndices.Add(Spacecraft, Targets.Add(Target));
+		UpdateTarget(Spacecraft);
+	}
+
+	// List the hostile targets of each company
+	HostileTargets.SetNum(Companies.Num());
+	for (int32 CompanyIndex = 0; CompanyIndex < Companies.Num(); CompanyIndex++)
+	{
+		for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); TargetIndex++)
+		{
+			const FFlareBattleTarget& Target = Targets[TargetIndex];
+
+			if (Target.Eligible && Companies[CompanyIndex]->GetWarState(Companies[Target.CompanyIndex]) == EFlareHostility::Hostile)
+			{
+				HostileTargets[CompanyIndex].Add(TargetIndex);
+			}
+		}
+	}
+
+	FLOGCV(LogFlareCombat, "UFlareBattle::BuildTargetTables : %d spacecraft from %d companies", Targets.Num(), Companies.Num());
+}
+
+void UFlareBattle::UpdateTarget(UFlareSimulatedSpacecraft* Spacecraft)
+{
+	int32* TargetIndex = TargetIndices.Find(Spacecraft);
+	if (!TargetIndex)
+	{
+		return;
+	}
+
+	FFlareBattleTarget& Target = Targets[*TargetIndex];
+	UFlareSimulatedSpacecraftDamageSystem* DamageSystem = Spacecraft->GetDamageSystem();
+	bool WasEligible = Target.Eligible;
+	bool Uncontrollable = DamageSystem->IsUncontrollable();
+	Target.Disarmed = DamageSystem->IsDisarmed();
+
+	// Same criteria as the sector scan in GetBestTarget
+	Target.StateKey = 0;
+	if (Spacecraft->GetSize() == EFlarePartSize::L)
+	{
+		Target.StateKey |= BATTLE_STATE_LARGE;
+	}
+	if (Spacecraft->GetSize() == EFlarePartSize::S)
+	{
+		Target.StateKey |= BATTLE_STATE_SMALL;
+	}
+	if (Spacecraft->IsStation())
+	{
+		Target.StateKey |= BATTLE_STATE_STATION;
+	}
+	if (Spacecraft->IsMilitary())
+	{
+		Target.StateKey |= BATTLE_STATE_MILITARY;
+	}
+	if (Spacecraft->IsMilitary() && !Target.Disarmed)
+	{
+		Target.StateKey |= BATTLE_STATE_DANGEROUS;
+	}
+	if (DamageSystem->IsStranded())
+	{
+		Target.StateKey |= BATTLE_STATE_STRANDED;
+	}
+	if (Uncontrollable && Target.Disarmed)
+	{
+		Target.StateKey |= BATTLE_STATE_UNCONTROLLABLE;
+	}
+	if (Spacecraft->IsHarpooned())
+	{
+		Target.StateKey |= BATTLE_STATE_HARPOONED;
+	}
+
+	// Destroyed ships and harpooned uncontrollable ships can't come back during a battle
+	Target.Eligible = DamageSystem->IsAlive() && !(Spacecraft->IsHarpooned() && Uncontrollable);
+
+	if (WasEligible && !Target.Eligible)
+	{
+		for (int32 CompanyIndex = 0; CompanyIndex < HostileTargets.Num(); CompanyIndex++)
+		{
+			HostileTargets[CompanyIndex].RemoveSwap(*TargetIndex);
+		}
+	}
+}
+
+bool UFlareBattle::SimulateCachedTurn()
+{
+	bool HasFight = false;
+
+	// Relations changed during the battle
+	if (HostilityVersion != Game->GetGameWorld()->GetHostilityVersion())
+	{
+		BuildTargetTables();
+	}
+
+	// List company in war
+	TArray<bool> FightingCompanies;
+	FightingCompanies.SetNum(Companies.Num());
+	for (int32 CompanyIndex = 0; CompanyIndex < Companies.Num(); CompanyIndex++)
+	{
+		FightingCompanies[CompanyIndex] = Sector->GetSectorBattleState(Companies[CompanyIndex]).WantFight();
+	}
+
+	// List all fighting ships
+	TurnOrder.Reset();
+	for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); TargetIndex++)
+	{
+		const FFlareBattleTarget& Target = Targets[TargetIndex];
+
+		if (Target.Fighter && !Target.Disarmed && FightingCompanies[Target.CompanyIndex])
+		{
+			TurnOrder.Add(TargetIndex);
+		}
+	}
+
+	// Play fighting ships in random order
+	for (int32 OrderIndex = TurnOrder.Num() - 1; OrderIndex > 0; OrderIndex--)
+	{
+		TurnOrder.Swap(OrderIndex, FMath::RandRange(0, OrderIndex));
+	}
+
+	for (int32 OrderIndex = 0; OrderIndex < TurnOrder.Num(); OrderIndex++)
+	{
+		if (SimulateShipTurn(Targets[TurnOrder[OrderIndex]].Spacecraft))
+		{
+			HasFight = true;
+		}
+	}
+
+	return HasFight;
+}
+
+UFlareSimulatedSpacecraft* UFlareBattle::GetBestCachedTarget(UFlareSimulatedSpacecraft* Ship, const BattleTargetPreferences& Preferences)
+{
+	int32* ShipIndex = TargetIndices.Find(Ship);
+	if (!ShipIndex)
+	{
+		return NULL;
+	}
+
+	const TArray<int32>& Candidates = HostileTargets[Targets[*ShipIndex].CompanyIndex];
+	UFlareSimulatedSpacecraft* BestTarget = NULL;
+	float BestScore = 0;
+
+	// New preferences, weights will be computed again
+	StateWeightStamp++;
+
+	for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); CandidateIndex++)
+	{
+		const FFlareBattleTarget& Candidate = Targets[Candidates[CandidateIndex]];
+		float StateScore = GetStateWeight(Candidate.StateKey, Preferences);
+
+		// This candidate can't win
+		if (StateScore <= 0)
+		{
+			continue;
+		}
+
+		float Score = StateScore * FMath::FRand();
+		if (Score > 0 && (BestTarget == NULL || Score > BestScore))
+		{
+			BestTarget = Candidate.Spacecraft;
+			BestScore = Score;
+		}
+	}
+
+	return BestTarget;
+}
+
+float UFlareBattle::GetStateWeight(uint8 StateKey, const BattleTargetPreferences& Preferences)
+{
+	if (StateWeightStamps[StateKey] == StateWeightStamp)
+	{
+		return StateWeights[StateKey];
+	}
+
+	float Weight = Preferences.TargetStateWeight;
+
+	if (StateKey & BATTLE_STATE_LARGE)
+	{
+		Weight *= Preferences.IsLarge;
+	}
+	if (StateKey & BATTLE_STATE_SMALL)
+	{
+		Weight *= Preferences.IsSmall;
+	}
+
+	Weight *= (StateKey & BATTLE_STATE_STATION) ? Preferences.IsStation : Preferences.IsNotStation;
+	Weight *= (StateKey & BATTLE_STATE_MILITARY) ? Preferences.IsMilitary : Preferences.IsNotMilitary;
+	Weight *= (StateKey & BATTLE_STATE_DANGEROUS) ? Preferences.IsDangerous : Preferences.IsNotDangerous;
+	Weight *= (StateKey & BATTLE_STATE_STRANDED) ? Preferences.IsStranded : Preferences.IsNotStranded;
+
+	if (StateKey & BATTLE_STATE_UNCONTROLLABLE)
+	{
+		Weight *= (StateKey & BATTLE_STATE_MILITARY) ? Preferences.IsUncontrollableMilitary : Preferences.IsUncontrollableCivil;
+	}
+	else
+	{
+		Weight *= Preferences.IsNotUncontrollable;
+	}
+
+	if (StateKey & BATTLE_STATE_HARPOONED)
+	{
+		Weight *= Preferences.IsHarpooned;
+	}
+
+	StateWeights[StateKey] = Weight;
+	StateWeightStamps[StateKey] = StateWeightStamp;
+	return Weight;
+}
+
+
 #undef LOCTEXT_NAMESPACE
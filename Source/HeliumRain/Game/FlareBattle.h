@@ -7,6 +7,18 @@
 class UFlareSpacecraftComponentsCatalog;
 
 
+/** Cached state of a spacecraft taking part in an automatic battle */
+struct FFlareBattleTarget
+{
+	UFlareSimulatedSpacecraft*              Spacecraft;
+	int32                                   CompanyIndex;
+	uint8                                   StateKey;
+	bool                                    Eligible;
+	bool                                    Fighter;
+	bool                                    Disarmed;
+};
+
+
 UCLASS()
 class HELIUMRAIN_API UFlareBattle : public UObject
 {
@@ -27,6 +39,9 @@ public:
 
 	void Simulate();
 
+	/** Use the original resolver, that scans the whole sector for every shot, instead of the cached target tables */
+	void SetLegacyResolver(bool Legacy);
+
 	bool SimulateTurn();
 
 	bool SimulateShipTurn(UFlareSimulatedSpacecraft* Ship);
@@ -51,10 +66,49 @@ public:
 
 protected:
 
+	/*----------------------------------------------------
+		Target tables
+	----------------------------------------------------*/
+
+	/** Snapshot the sector spacecraft and the hostile targets of each company */
+	void BuildTargetTables();
+
+	/** Refresh the cached state of a spacecraft after it fired or was hit */
+	void UpdateTarget(UFlareSimulatedSpacecraft* Spacecraft);
+
+	/** Pick a fighting order for the ships of the companies that want to fight */
+	bool SimulateCachedTurn();
+
+	/** Find the best target in the cached hostile target list of the ship company */
+	UFlareSimulatedSpacecraft* GetBestCachedTarget(UFlareSimulatedSpacecraft* Ship, const struct BattleTargetPreferences& Preferences);
+
+	/** Get the target weight for a spacecraft state, computed once per state and preferences */
+	float GetStateWeight(uint8 StateKey, const struct BattleTargetPreferences& Preferences);
+
+
+	/*----------------------------------------------------
+		Protected data
+	----------------------------------------------------*/
+
 	UFlareSimulatedSector*                  Sector;
 	AFlareGame*                             Game;
 	UFlareCompany*                          PlayerCompany;
 	UFlareSpacecraftComponentsCatalog*      Catalog;
+	int32                                   TurnCount;
+	bool                                    UseLegacyResolver;
+
+	// Target tables
+	int32                                   HostilityVersion;
+	TArray<FFlareBattleTarget>              Targets;
+	TMap<UFlareSimulatedSpacecraft*, int32> TargetIndices;
+	TArray<UFlareCompany*>                  Companies;
+	TArray<TArray<int32>>                   HostileTargets;
+	TArray<int32>                           TurnOrder;
+
+	// Weights of each spacecraft state for the current preferences
+	float                                   StateWeights[256];
+	uint32                                  StateWeightStamps[256];
+	uint32                                  StateWeightStamp;
 
 public:
 
@@ -67,5 +121,11 @@ public:
 		return Game;
 	}
 
+	/** Number of turns played by the last simulation */
+	int32 GetTurnCount() const
+	{
+		return TurnCount;
+	}
+
         bool HasBattle();
 };
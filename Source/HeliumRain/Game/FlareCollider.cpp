@@ -1,6 +1,7 @@
 
 #include "../Flare.h"
 #include "FlareCollider.h"
+#include "FlareGame.h"
 
 
 /*----------------------------------------------------
@@ -18,3 +19,30 @@ AFlareCollider::AFlareCollider(const class FObjectInitializer& PCIP) : Super(PCI
 	RootComponent = CollisionComponent;
 }
 
+
+/*----------------------------------------------------
+	Public interface
+----------------------------------------------------*/
+
+void AFlareCollider::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Sectors get their colliders from the game instead of searching the world
+	AFlareGame* Game = Cast<AFlareGame>(GetWorld()->GetAuthGameMode());
+	if (Game)
+	{
+		Game->RegisterCollider(this);
+	}
+}
+
+void AFlareCollider::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	AFlareGame* Game = Cast<AFlareGame>(GetWorld()->GetAuthGameMode());
+	if (Game)
+	{
+		Game->UnregisterCollider(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
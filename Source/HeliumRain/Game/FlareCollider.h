@@ -10,6 +10,20 @@ public:
 
 	GENERATED_UCLASS_BODY()
 
+	/*----------------------------------------------------
+		Public interface
+	----------------------------------------------------*/
+
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Radius of the collider bounds */
+	inline float GetColliderRadius() const
+	{
+		return CollisionComponent->Bounds.SphereRadius;
+	}
+
 
 protected:
 
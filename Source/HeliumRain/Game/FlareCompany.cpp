@@ -9,6 +9,7 @@
 #include "../Spacecrafts/FlareSimulatedSpacecraft.h"
 #include "AI/FlareCompanyAI.h"
 #include "AI/FlareAIBehavior.h"
+#include "Save/FlareSaveCache.h"
 
 
 #define LOCTEXT_NAMESPACE "FlareCompany"
@@ -20,6 +21,7 @@
 
 UFlareCompany::UFlareCompany(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, SaveRevision(0)
 {
 }
 
@@ -112,43 +114,26 @@ void UFlareCompany::PostLoad()
 	}
 
 	CompanyAI->Load(this, CompanyData.AI);
+	SetDirty();
 }
 
-FFlareCompanySave* UFlareCompany::Save()
+void UFlareCompany::Save(FFlareCompanySave& Snapshot)
 {
+	// Fleets, trade routes and spacecrafts are only kept in the company data until they are loaded
 	CompanyData.Fleets.Empty();
 	CompanyData.TradeRoutes.Empty();
 	CompanyData.ShipData.Empty();
 	CompanyData.StationData.Empty();
-	CompanyData.SectorsKnowledge.Empty();
-
-	for (int i = 0 ; i < CompanyFleets.Num(); i++)
-	{
-		CompanyData.Fleets.Add(*CompanyFleets[i]->Save());
-	}
-
-	for (int i = 0 ; i < CompanyTradeRoutes.Num(); i++)
-	{
-		CompanyData.TradeRoutes.Add(*CompanyTradeRoutes[i]->Save());
-	}
-
-	for (int i = 0 ; i < CompanyShips.Num(); i++)
-	{
-		CompanyData.ShipData.Add(*CompanyShips[i]->Save());
-	}
-
-	for (int i = 0 ; i < CompanyStations.Num(); i++)
-	{
-		CompanyData.StationData.Add(*CompanyStations[i]->Save());
-	}
 
+	// Knowledge, value and AI are computed from other objects, compare them with the previous save
+	TArray<FFlareCompanySectorKnowledge> SectorsKnowledge;
 	for (int i = 0 ; i < VisitedSectors.Num(); i++)
 	{
 		FFlareCompanySectorKnowledge SectorKnowledge;
 		SectorKnowledge.Knowledge = EFlareSectorKnowledge::Visited;
 		SectorKnowledge.SectorIdentifier = VisitedSectors[i]->GetIdentifier();
 
-		CompanyData.SectorsKnowledge.Add(SectorKnowledge);
+		SectorsKnowledge.Add(SectorKnowledge);
 	}
 
 	for (int i = 0 ; i < KnownSectors.Num(); i++)
@@ -160,15 +145,53 @@ FFlareCompanySave* UFlareCompany::Save()
 			SectorKnowledge.Knowledge = EFlareSectorKnowledge::Known;
 			SectorKnowledge.SectorIdentifier = KnownSectors[i]->GetIdentifier();
 
-			CompanyData.SectorsKnowledge.Add(SectorKnowledge);
+			SectorsKnowledge.Add(SectorKnowledge);
 		}
 	}
 
-	CompanyData.CompanyValue = GetCompanyValue().TotalValue;
+	int64 CompanyValue = GetCompanyValue().TotalValue;
+	FFlareCompanyAISave* AIData = CompanyAI->Save();
+
+	if (CompanyValue != CompanyData.CompanyValue
+	 || !FFlareSaveCache::IsSameData(SectorsKnowledge, CompanyData.SectorsKnowledge)
+	 || !FFlareSaveCache::IsSameData(*AIData, CompanyData.AI))
+	{
+		CompanyData.SectorsKnowledge = SectorsKnowledge;
+		CompanyData.CompanyValue = CompanyValue;
+		CompanyData.AI = *AIData;
+		SetDirty();
+	}
 
-	CompanyData.AI = *CompanyAI->Save();
+	Snapshot = CompanyData;
 
-	return &CompanyData;
+	Snapshot.Fleets.Reserve(CompanyFleets.Num());
+	for (int i = 0 ; i < CompanyFleets.Num(); i++)
+	{
+		Snapshot.Fleets.Add(*CompanyFleets[i]->Save());
+	}
+
+	Snapshot.TradeRoutes.Reserve(CompanyTradeRoutes.Num());
+	for (int i = 0 ; i < CompanyTradeRoutes.Num(); i++)
+	{
+		Snapshot.TradeRoutes.Add(*CompanyTradeRoutes[i]->Save());
+	}
+
+	Snapshot.ShipData.Reserve(CompanyShips.Num());
+	for (int i = 0 ; i < CompanyShips.Num(); i++)
+	{
+		Snapshot.ShipData.Add(*CompanyShips[i]->Save());
+	}
+
+	Snapshot.StationData.Reserve(CompanyStations.Num());
+	for (int i = 0 ; i < CompanyStations.Num(); i++)
+	{
+		Snapshot.StationData.Add(*CompanyStations[i]->Save());
+	}
+}
+
+void UFlareCompany::SetDirty()
+{
+	SaveRevision = FFlareSaveCache::NewRevision();
 }
 
 
@@ -246,6 +269,8 @@ void UFlareCompany::SetHostilityTo(UFlareCompany* TargetCompany, bool Hostile)
 		if (Hostile && !WasHostile)
 		{
 			CompanyData.HostileCompanies.AddUnique(TargetCompany->GetIdentifier());
+			SetDirty();
+			Game->GetGameWorld()->OnHostilityChanged();
 			TargetCompany->GiveReputation(this, -50, true);
 
 			UFlareCompany* PlayerCompany = Game->GetPC()->GetCompany();
@@ -268,6 +293,8 @@ void UFlareCompany::SetHostilityTo(UFlareCompany* TargetCompany, bool Hostile)
 		else if(!Hostile && WasHostile)
 		{
 			CompanyData.HostileCompanies.Remove(TargetCompany->GetIdentifier());
+			SetDirty();
+			Game->GetGameWorld()->OnHostilityChanged();
 
 			UFlareCompany* PlayerCompany = Game->GetPC()->GetCompany();
 			if(TargetCompany == PlayerCompany)
@@ -317,6 +344,7 @@ UFlareFleet* UFlareCompany::CreateFleet(FText FleetName, UFlareSimulatedSector*
 	// Create the fleet
 	FFlareFleetSave FleetData;
 	FleetData.Identifier = FName(*(GetIdentifier().ToString() + "-" + FString::FromInt(CompanyData.FleetImmatriculationIndex++)));
+	SetDirty();
 	FleetData.Name = FleetName;
 	UFlareFleet* Fleet = LoadFleet(FleetData);
 	Fleet->SetCurrentSector(FleetSector);
@@ -402,6 +430,7 @@ UFlareTradeRoute* UFlareCompany::CreateTradeRoute(FText TradeRouteName)
 	// Create the trade route
 	FFlareTradeRouteSave TradeRouteData;
 	TradeRouteData.Identifier = FName(*(GetIdentifier().ToString() + "-" + FString::FromInt(CompanyData.TradeRouteImmatriculationIndex++)));
+	SetDirty();
 	TradeRouteData.Name = TradeRouteName;
 	TradeRouteData.TargetSectorIdentifier = NAME_None;
 	TradeRouteData.CurrentOperationIndex = 0;
@@ -521,6 +550,7 @@ bool UFlareCompany::TakeMoney(int64 Amount, bool AllowDepts)
 	else
 	{
 		CompanyData.Money -= Amount;
+		SetDirty();
 		/*if (Amount > 0)
 		{
 
@@ -540,6 +570,7 @@ void UFlareCompany::GiveMoney(int64 Amount)
 	}
 
 	CompanyData.Money += Amount;
+	SetDirty();
 	/*if (Amount > 0)
 	{
 		FLOGV("$ %s + %lld -> %llu", *GetCompanyName().ToString(), Amount, CompanyData.Money);
@@ -623,6 +654,7 @@ void UFlareCompany::GiveReputation(UFlareCompany* Company, float Amount, bool Pr
 	}
 
 	CompanyReputation->Reputation = FMath::Clamp(CompanyReputation->Reputation + Amount * DiplomaticReactivity, -200.f, 200.f);
+	SetDirty();
 
 	if (Propagate)
 	{
@@ -693,6 +725,7 @@ void UFlareCompany::ForceReputation(UFlareCompany* Company, float Amount)
 	}
 
 	CompanyReputation->Reputation = Amount;
+	SetDirty();
 }
 //#define DEBUG_CONFIDENCE
 float UFlareCompany::GetConfidenceLevel(UFlareCompany* ReferenceCompany)
@@ -97,7 +97,10 @@ public:
 	virtual void PostLoad();
 
 	/** Save the company to a save file */
-	virtual FFlareCompanySave* Save();
+	virtual void Save(FFlareCompanySave& Snapshot);
+
+	/** Signal that the company save data changed since the last save, not including spacecrafts, fleets and trade routes */
+	void SetDirty();
 
 	/** Spawn a simulated spacecraft from save data */
 	virtual UFlareSimulatedSpacecraft* LoadSpacecraft(const FFlareSpacecraftSave& SpacecraftData);
@@ -213,6 +216,7 @@ protected:
 	// Gameplay data
 	const FFlareCompanyDescription*         CompanyDescription;
 	FFlareCompanySave                       CompanyData;
+	uint64                                  SaveRevision;
 
 	UPROPERTY()
 	UFlareCompanyAI*                         CompanyAI;
@@ -255,6 +259,12 @@ public:
 	/** Get the hostility text */
 	FText GetPlayerHostilityText() const;
 
+	/** Revision of the company save data, changed each time the data is modified */
+	inline uint64 GetSaveRevision() const
+	{
+		return SaveRevision;
+	}
+
 	inline AFlareGame* GetGame() const
 	{
 		return Game;
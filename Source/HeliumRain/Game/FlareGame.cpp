@@ -19,9 +19,13 @@
 #include "Save/FlareSaveGameSystem.h"
 #include "AssetRegistryModule.h"
 #include "Log/FlareLogWriter.h"
+#include "../../HeliumRainLoadingScreen/FlareLoadingScreen.h"
 
 #define LOCTEXT_NAMESPACE "FlareGame"
 
+#define MAX_POOLED_SPACECRAFTS 100
+#define MAX_POOLED_ASTEROIDS 100
+
 
 /*----------------------------------------------------
 	Constructor
@@ -231,7 +235,9 @@ UFlareSimulatedSector* AFlareGame::DeactivateSector()
 
 	UFlareSimulatedSector* Sector = ActiveSector->GetSimulatedSector();
 	FLOGV("AFlareGame::DeactivateSector : %s", *Sector->GetSectorName().ToString());
-	World->Save();
+	// Store the sector state into the simulated objects
+	FFlareWorldSave Snapshot;
+	World->Save(Snapshot);
 
 	// Set last flown ship
 	UFlareSimulatedSpacecraft* PlayerShip = NULL;
@@ -370,6 +376,12 @@ void AFlareGame::Tick(float DeltaSeconds)
 		QuestManager->OnTick(DeltaSeconds);
 	}
 
+	// Spawn the remaining spacecrafts of the active sector
+	if (ActiveSector && ActiveSector->IsActivating())
+	{
+		ActiveSector->UpdateActivation();
+	}
+
 	if(GetActiveSector() != NULL)
 	{
 		for (int CompanyIndex = 0; CompanyIndex < GetGameWorld()->GetCompanies().Num(); CompanyIndex++)
@@ -642,18 +654,48 @@ UFlareCompany* AFlareGame::CreateCompany(int32 CatalogIdentifier)
 	return Company;
 }
 
+UFlareWorld* AFlareGame::CreateSimulationWorld()
+{
+	if (LoadedOrCreated)
+	{
+		FLOG("AFlareGame::CreateSimulationWorld failed: a game is loaded");
+		return NULL;
+	}
+
+	Clean();
+
+	// Create the new world
+	World = NewObject<UFlareWorld>(this, UFlareWorld::StaticClass());
+	FFlareWorldSave WorldData;
+	WorldData.Date = 0;
+	World->Load(WorldData);
+
+	// Create companies
+	for (int32 Index = 0; Index < GetCompanyCatalogCount(); Index++)
+	{
+		CreateCompany(Index);
+	}
+
+	return World;
+}
+
 bool AFlareGame::LoadGame(AFlarePlayerController* PC)
 {
 	FLOGV("AFlareGame::LoadGame : loading from slot %d", CurrentSaveIndex);
+	double StartTime = FPlatformTime::Seconds();
 	PlayerController = PC;
 	Clean();
 	PC->Clean();
 
+	// Data phase : read the file and decode companies and sectors on all cores
+	SetLoadingProgress(0.0f, LOCTEXT("LoadingSave", "Reading save"));
 	UFlareSaveGame* Save = ReadSaveSlot(CurrentSaveIndex);
 
 	// Load from save
 	if (PC && Save)
 	{
+		// Object phase : create the game objects from the decoded data
+		SetLoadingProgress(0.6f, LOCTEXT("LoadingWorld", "Creating the world"));
 		PC->SetCompanyDescription(Save->PlayerCompanyDescription);
 
         // Create the new world
@@ -666,16 +708,19 @@ bool AFlareGame::LoadGame(AFlarePlayerController* PC)
         // TODO check if load is ok for ship event before the PC load
 
 		// Load the player
+		SetLoadingProgress(0.85f, LOCTEXT("LoadingPlayer", "Loading the player"));
 		PC->Load(Save->PlayerData);
 		PC->GetCompany()->SetupEmblem();
 
 		// Create world tools
+		SetLoadingProgress(0.9f, LOCTEXT("LoadingCheck", "Checking the world"));
 		ScenarioTools = NewObject<UFlareScenarioTools>(this, UFlareScenarioTools::StaticClass());
 		ScenarioTools->Init(PC->GetCompany(), &Save->PlayerData);
 		World->PostLoad();
 		World->CheckIntegrity();
 
 		// Init the quest manager
+		SetLoadingProgress(0.95f, LOCTEXT("LoadingQuests", "Loading quests"));
 		QuestManager = NewObject<UFlareQuestManager>(this, UFlareQuestManager::StaticClass());
 		QuestManager->Load(Save->PlayerData.QuestData);
 
@@ -683,6 +728,8 @@ bool AFlareGame::LoadGame(AFlarePlayerController* PC)
 		PC->OnLoadComplete();
 		FFlareLogWriter::InitWriter(Save->PlayerData.UUID);
 
+		SetLoadingProgress(1.0f, LOCTEXT("LoadingDone", "Starting"));
+		FLOGV("AFlareGame::LoadGame : loaded in %f s", FPlatformTime::Seconds() - StartTime);
 		return true;
 	}
 
@@ -694,36 +741,15 @@ bool AFlareGame::LoadGame(AFlarePlayerController* PC)
 	}
 }
 
-
-class FAsyncSave : public FNonAbandonableTask
+void AFlareGame::SetLoadingProgress(float Progress, FText Status)
 {
-	friend class FAutoDeleteAsyncTask<FAsyncSave>;
-public:
-	FAsyncSave(UFlareSaveGameSystem* SaveSystemParam, const FString SaveNameParam, UFlareSaveGame *SaveDataParam) :
-		SaveName(SaveNameParam),
-		SaveData(SaveDataParam),
-		SaveSystem(SaveSystemParam)
-	{}
-
-protected:
-	FString SaveName;
-	UFlareSaveGame *SaveData;
-	UFlareSaveGameSystem* SaveSystem;
-
-	void DoWork()
+	IFlareLoadingScreenModule* LoadingScreenModule = FModuleManager::GetModulePtr<IFlareLoadingScreenModule>("HeliumRainLoadingScreen");
+	if (LoadingScreenModule)
 	{
-		FLOG("Async save start");
-		SaveSystem->SaveGame(SaveName, SaveData);
-		FLOG("Async save end");
+		LoadingScreenModule->SetLoadingProgress(Progress, Status);
 	}
+}
 
-	// This next section of code needs to be here.  Not important as to why.
-
-	FORCEINLINE TStatId GetStatId() const
-	{
-		RETURN_QUICK_DECLARE_CYCLE_STAT(FAsyncSave, STATGROUP_ThreadPoolAsyncTasks);
-	}
-};
 
 bool AFlareGame::SaveGame(AFlarePlayerController* PC, bool Async)
 {
@@ -741,7 +767,8 @@ bool AFlareGame::SaveGame(AFlarePlayerController* PC, bool Async)
 	{
 		// Save the player
 		PC->Save(Save->PlayerData, Save->PlayerCompanyDescription);
-		Save->WorldData = *World->Save();
+		World->Save(Save->WorldData);
+		World->SaveRevisions(Save);
 		Save->CurrentImmatriculationIndex = CurrentImmatriculationIndex;
 		Save->CurrentIdentifierIndex = CurrentIdentifierIndex;
 		Save->PlayerData.QuestData = *QuestManager->Save();
@@ -752,14 +779,14 @@ bool AFlareGame::SaveGame(AFlarePlayerController* PC, bool Async)
 
 		// Save prototype
 
-		SaveGameSystem->PushSaveData(Save);
-
 		if(Async)
 		{
-			(new FAutoDeleteAsyncTask<FAsyncSave>(SaveGameSystem, SaveName, Save))->StartBackgroundTask();
+			SaveGameSystem->QueueSave(SaveName, Save);
 		}
 		else
 		{
+			SaveGameSystem->CancelQueuedSave(SaveName);
+			SaveGameSystem->PushSaveData(Save);
 			SaveGameSystem->SaveGame(SaveName, Save);
 		}
 
@@ -786,6 +813,7 @@ void AFlareGame::UnloadGame()
 		ActiveSector = NULL;
 	}
 	DebrisFieldSystem->Reset();
+	EmptyActorPools();
 
 	// Cleanup stuff
 	Clean();
@@ -903,8 +931,6 @@ void AFlareGame::OnLevelLoaded()
 	FLOGV("AFlareGame::OnLevelLoaded : PlayerHasShip = %d", PlayerHasShip);
 	if (PlayerHasShip)
 	{
-		CombatLog::SectorActivated(ActivatingSector);
-
 		// Create the new sector
 		ActiveSector = NewObject<UFlareSector>(this, UFlareSector::StaticClass());
 		FFlareSectorSave* SectorData = ActivatingSector->Save();
@@ -914,15 +940,17 @@ void AFlareGame::OnLevelLoaded()
 			SectorData->LocalTime = GetGameWorld()->GetDate() * UFlareGameTools::SECONDS_IN_DAY;
 		}
 
-		// Load and setup the sector
+		// Load and setup the sector, the player ship and nearby spacecrafts are spawned now and the rest over the next frames
+		// The player flies its ship as soon as the sector spawns it, quests are notified once all spacecrafts are spawned
 		Planetarium->ResetTime();
 		Planetarium->SkipNight(UFlareGameTools::SECONDS_IN_DAY);
-		ActiveSector->Load(ActivatingSector);
 		DebrisFieldSystem->Setup(this, ActivatingSector);
-
-		GetPC()->OnSectorActivated(ActiveSector);
+		ActiveSector->Load(ActivatingSector);
+	}
+	else
+	{
+		GetQuestManager()->OnSectorActivation(ActivatingSector);
 	}
-	GetQuestManager()->OnSectorActivation(ActivatingSector);
 
 	ActivatingSector = NULL;
 }
@@ -934,6 +962,94 @@ void AFlareGame::OnLevelUnLoaded()
 }
 
 
+/*----------------------------------------------------
+	Actor recycling
+----------------------------------------------------*/
+
+AFlareSpacecraft* AFlareGame::AcquireSpacecraft(UClass* SpacecraftClass, FVector Location, FRotator Rotation)
+{
+	for (int32 Index = SpacecraftPool.Num() - 1; Index >= 0; Index--)
+	{
+		AFlareSpacecraft* Spacecraft = SpacecraftPool[Index];
+		if (Spacecraft && Spacecraft->GetClass() == SpacecraftClass)
+		{
+			SpacecraftPool.RemoveAtSwap(Index);
+			Spacecraft->RecycleAt(Location, Rotation);
+			return Spacecraft;
+		}
+	}
+
+	return NULL;
+}
+
+void AFlareGame::ReleaseSpacecraft(AFlareSpacecraft* Spacecraft)
+{
+	// The possessed ship is not recycled, nor spacecrafts over the pool capacity
+	if (SpacecraftPool.Num() >= MAX_POOLED_SPACECRAFTS || Spacecraft->GetController() || Spacecraft->IsPendingKill())
+	{
+		Spacecraft->Destroy();
+	}
+	else
+	{
+		Spacecraft->PrepareForRecycling();
+		SpacecraftPool.Add(Spacecraft);
+	}
+}
+
+AFlareAsteroid* AFlareGame::AcquireAsteroid(FVector Location, FRotator Rotation)
+{
+	if (AsteroidPool.Num())
+	{
+		AFlareAsteroid* Asteroid = AsteroidPool.Pop();
+		Asteroid->RecycleAt(Location, Rotation);
+		return Asteroid;
+	}
+
+	return NULL;
+}
+
+void AFlareGame::ReleaseAsteroid(AFlareAsteroid* Asteroid)
+{
+	if (AsteroidPool.Num() >= MAX_POOLED_ASTEROIDS || Asteroid->IsPendingKill())
+	{
+		Asteroid->Destroy();
+	}
+	else
+	{
+		Asteroid->PrepareForRecycling();
+		AsteroidPool.Add(Asteroid);
+	}
+}
+
+void AFlareGame::EmptyActorPools()
+{
+	FLOGV("AFlareGame::EmptyActorPools : destroying %d spacecrafts, %d asteroids", SpacecraftPool.Num(), AsteroidPool.Num());
+
+	for (int32 Index = 0; Index < SpacecraftPool.Num(); Index++)
+	{
+		SpacecraftPool[Index]->Destroy();
+	}
+
+	for (int32 Index = 0; Index < AsteroidPool.Num(); Index++)
+	{
+		AsteroidPool[Index]->Destroy();
+	}
+
+	SpacecraftPool.Empty();
+	AsteroidPool.Empty();
+}
+
+void AFlareGame::RegisterCollider(AFlareCollider* Collider)
+{
+	Colliders.AddUnique(Collider);
+}
+
+void AFlareGame::UnregisterCollider(AFlareCollider* Collider)
+{
+	Colliders.Remove(Collider);
+}
+
+
 /*----------------------------------------------------
 	Immatriculations
 ----------------------------------------------------*/
@@ -1114,5 +1230,11 @@ inline const FFlareCompanyDescription* AFlareGame::GetPlayerCompanyDescription()
 	return PC->GetCompanyDescription();
 }
 
+UFlareQuestCatalog* AFlareGame::GetQuestCatalog() const
+{
+	QuestCatalog->WaitForLoad();
+	return QuestCatalog;
+}
+
 
 #undef LOCTEXT_NAMESPACE
@@ -31,6 +31,7 @@ class UFlareQuestCatalog;
 class UFlareDebrisField;
 class UFlareSectorCatalogEntry;
 class UFlareScenarioTools;
+class AFlareCollider;
 struct FFlarePlayerSave;
 
 
@@ -120,6 +121,9 @@ public:
 	/** Create a company */
 	UFlareCompany* CreateCompany(int32 CatalogIdentifier);
 
+	/** Create an empty world with the catalog companies and no player, for offline simulations while no game is loaded. Clean() discards it */
+	UFlareWorld* CreateSimulationWorld();
+
     /** Load the game from this save file */
     virtual bool LoadGame(AFlarePlayerController* PC);
 
@@ -150,6 +154,32 @@ public:
 	void OnLevelUnLoaded();
 
 
+	/*----------------------------------------------------
+		Actor recycling
+	----------------------------------------------------*/
+
+	/** Get a recycled spacecraft of this class at this location, or NULL if none is available */
+	AFlareSpacecraft* AcquireSpacecraft(UClass* SpacecraftClass, FVector Location, FRotator Rotation);
+
+	/** Deactivate a spacecraft and keep it for a later sector, or destroy it */
+	void ReleaseSpacecraft(AFlareSpacecraft* Spacecraft);
+
+	/** Get a recycled asteroid at this location, or NULL if none is available */
+	AFlareAsteroid* AcquireAsteroid(FVector Location, FRotator Rotation);
+
+	/** Deactivate an asteroid and keep it for a later sector, or destroy it */
+	void ReleaseAsteroid(AFlareAsteroid* Asteroid);
+
+	/** Destroy all recycled actors */
+	void EmptyActorPools();
+
+	/** Keep track of a collider from the sector levels */
+	void RegisterCollider(AFlareCollider* Collider);
+
+	/** Forget a collider that left the world */
+	void UnregisterCollider(AFlareCollider* Collider);
+
+
 	/*----------------------------------------------------
 		Immatriculations
 	----------------------------------------------------*/
@@ -171,6 +201,14 @@ public:
 
 protected:
 
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Report the progress of a game load on the loading screen */
+	void SetLoadingProgress(float Progress, FText Status);
+
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -207,6 +245,18 @@ protected:
 	UPROPERTY()
 	UFlareDebrisField*                         DebrisFieldSystem;
 
+	/** Deactivated spacecrafts, ready to be loaded again */
+	UPROPERTY()
+	TArray<AFlareSpacecraft*>                  SpacecraftPool;
+
+	/** Deactivated asteroids, ready to be loaded again */
+	UPROPERTY()
+	TArray<AFlareAsteroid*>                    AsteroidPool;
+
+	/** Colliders currently in the world */
+	UPROPERTY()
+	TArray<AFlareCollider*>                    Colliders;
+
 	/** Player controller */
 	UPROPERTY()
 	AFlarePlayerController*			           PlayerController;
@@ -330,6 +380,11 @@ public:
 		return Planetarium;
 	}
 
+	inline const TArray<AFlareCollider*>& GetColliders() const
+	{
+		return Colliders;
+	}
+
 	inline UFlareQuestManager* GetQuestManager() const
 	{
 		return QuestManager;
@@ -356,6 +411,7 @@ public:
 
 	inline UFlareSpacecraftCatalog* GetSpacecraftCatalog() const
 	{
+		SpacecraftCatalog->WaitForLoad();
 		return SpacecraftCatalog;
 	}
 
@@ -371,6 +427,7 @@ public:
 
 	inline UFlareSpacecraftComponentsCatalog* GetShipPartsCatalog() const
 	{
+		ShipPartsCatalog->WaitForLoad();
 		return ShipPartsCatalog;
 	}
 
@@ -389,13 +446,11 @@ public:
 		return CompanyCatalog;
 	}
 
-	inline UFlareQuestCatalog* GetQuestCatalog() const
-	{
-		return QuestCatalog;
-	}
+	UFlareQuestCatalog* GetQuestCatalog() const;
 
 	inline UFlareResourceCatalog* GetResourceCatalog() const
 	{
+		ResourceCatalog->WaitForLoad();
 		return ResourceCatalog;
 	}
 
@@ -6,10 +6,13 @@
 #include "../Player/FlarePlayerController.h"
 #include "FlareCompany.h"
 #include "FlareSectorHelper.h"
+#include "FlareBattle.h"
+#include "Log/FlareLogWriter.h"
 
 #define LOCTEXT_NAMESPACE "FlareGameTools"
 
 bool UFlareGameTools::FastFastForward = false;
+bool UFlareGameTools::SaveCacheCheck = false;
 
 /*----------------------------------------------------
 	Constructor
@@ -433,6 +436,72 @@ void UFlareGameTools::SetFastFastForward(bool FFF)
 	FastFastForward = FFF;
 }
 
+void UFlareGameTools::SetSaveCacheCheck(bool Check)
+{
+	SaveCacheCheck = Check;
+}
+
+static FLogCategoryBase* FlareSubsystemLogCategories[] =
+{
+	&LogFlareAI,
+	&LogFlareEconomy,
+	&LogFlareTravel,
+	&LogFlareCombat,
+	&LogFlareSave
+};
+
+void UFlareGameTools::SetLogVerbosity(FName Subsystem, bool Verbose)
+{
+	bool Found = false;
+	FString CategoryName = FString("LogFlare") + Subsystem.ToString();
+
+	for (int32 Index = 0; Index < ARRAY_COUNT(FlareSubsystemLogCategories); Index++)
+	{
+		FLogCategoryBase* Category = FlareSubsystemLogCategories[Index];
+
+		if (Subsystem == "All" || Category->GetCategoryName() == FName(*CategoryName))
+		{
+			Category->SetVerbosity(Verbose ? ELogVerbosity::Log : ELogVerbosity::Warning);
+			Found = true;
+		}
+	}
+
+	if (!Found)
+	{
+		FLOGV("UFlareGameTools::SetLogVerbosity failed: no subsystem '%s'", *Subsystem.ToString());
+	}
+}
+
+void UFlareGameTools::PrintLogStatus()
+{
+	for (int32 Index = 0; Index < ARRAY_COUNT(FlareSubsystemLogCategories); Index++)
+	{
+		FLogCategoryBase* Category = FlareSubsystemLogCategories[Index];
+		FLOGV("%s : %s", *Category->GetCategoryName().ToString(),
+			(Category->IsSuppressed(ELogVerbosity::Display) ? TEXT("muted") : TEXT("verbose")));
+	}
+
+	FLOGV("%d messages muted", GFlareSuppressedLogCount.GetValue());
+}
+
+void UFlareGameTools::DecodeLogFiles()
+{
+	FString LogDirectory = FPaths::GameSavedDir() / TEXT("SaveGames");
+	TArray<FString> LogFiles;
+	IFileManager::Get().FindFiles(LogFiles, *(LogDirectory / TEXT("*.flarelog")), true, false);
+
+	for (int32 Index = 0; Index < LogFiles.Num(); Index++)
+	{
+		FString InputFileName = LogDirectory / LogFiles[Index];
+		FString OutputFileName = FPaths::ChangeExtension(InputFileName, TEXT("decoded.log"));
+
+		if (FFlareLogWriter::DecodeLogFile(InputFileName, OutputFileName))
+		{
+			FLOGV("UFlareGameTools::DecodeLogFiles : decoded '%s'", *OutputFileName);
+		}
+	}
+}
+
 /*----------------------------------------------------
 	Company tools
 ----------------------------------------------------*/
@@ -1141,6 +1210,180 @@ void UFlareGameTools::PrintSectorByIndex(int32 Index)
 	PrintSector(Sectors[Index]->GetIdentifier());
 }
 
+void UFlareGameTools::CompareBattleResolvers(int32 RunCount)
+{
+	if (GetGame()->IsLoadedOrCreated())
+	{
+		FLOG("UFlareGameTools::CompareBattleResolvers failed: unload the game first");
+		return;
+	}
+
+	if (RunCount < 20)
+	{
+		FLOG("UFlareGameTools::CompareBattleResolvers failed: need at least 20 runs");
+		return;
+	}
+
+	// Pick the spacecrafts of the synthetic battles
+	UFlareSpacecraftCatalog* SpacecraftCatalog = GetGame()->GetSpacecraftCatalog();
+	FFlareSpacecraftDescription* FighterDescription = NULL;
+	FFlareSpacecraftDescription* CivilianDescription = NULL;
+	FFlareSpacecraftDescription* CapitalDescription = NULL;
+	FFlareSpacecraftDescription* StationDescription = NULL;
+
+	for (int32 Index = 0; Index < SpacecraftCatalog->ShipCatalog.Num(); Index++)
+	{
+		FFlareSpacecraftDescription* Description = &SpacecraftCatalog->ShipCatalog[Index]->Data;
+		if (Description->Size == EFlarePartSize::S && Description->IsMilitary() && !FighterDescription)
+		{
+			FighterDescription = Description;
+		}
+		else if (Description->Size == EFlarePartSize::S && !Description->IsMilitary() && !CivilianDescription)
+		{
+			CivilianDescription = Description;
+		}
+		else if (Description->Size == EFlarePartSize::L && Description->IsMilitary() && !CapitalDescription)
+		{
+			CapitalDescription = Description;
+		}
+	}
+
+	for (int32 Index = 0; Index < SpacecraftCatalog->StationCatalog.Num() && !StationDescription; Index++)
+	{
+		if (!SpacecraftCatalog->StationCatalog[Index]->Data.IsSubstation)
+		{
+			StationDescription = &SpacecraftCatalog->StationCatalog[Index]->Data;
+		}
+	}
+
+	if (!FighterDescription || !CivilianDescription || !CapitalDescription || !StationDescription)
+	{
+		FLOG("UFlareGameTools::CompareBattleResolvers failed: missing spacecraft types in the catalog");
+		return;
+	}
+
+	// Fighter duel, fighters against an escorted convoy, capital ship and fighters against a defended station
+	const int32 BattleCount = 3;
+	const TCHAR* BattleNames[BattleCount] = { TEXT("fighter duel"), TEXT("convoy raid"), TEXT("station siege") };
+	FFlareSpacecraftDescription* BattleSpacecrafts[BattleCount][2][3] = {
+		{ { FighterDescription, FighterDescription, FighterDescription }, { FighterDescription, FighterDescription, FighterDescription } },
+		{ { FighterDescription, FighterDescription, FighterDescription }, { FighterDescription, CivilianDescription, CivilianDescription } },
+		{ { CapitalDescription, FighterDescription, FighterDescription }, { StationDescription, FighterDescription, FighterDescription } }
+	};
+	const int32 BattleSpacecraftCounts[BattleCount][2][3] = {
+		{ { 4, 0, 0 }, { 4, 0, 0 } },
+		{ { 3, 0, 0 }, { 2, 3, 0 } },
+		{ { 1, 2, 0 }, { 1, 3, 0 } }
+	};
+
+	// Play one battle in a new world, outcome is 0 or 1 when only this side can still fight, 2 otherwise
+	auto PlayBattle = [&](int32 BattleIndex, bool Legacy, int32 Seed, int32& Outcome, int32& TurnCount)
+	{
+		FMath::RandInit(Seed);
+		UFlareWorld* SimulationWorld = GetGame()->CreateSimulationWorld();
+		FCHECK(SimulationWorld && SimulationWorld->GetCompanies().Num() >= 2 && SimulationWorld->GetSectors().Num() >= 1);
+
+		UFlareSimulatedSector* Sector = SimulationWorld->GetSectors()[0];
+		UFlareCompany* Sides[2] = { SimulationWorld->GetCompanies()[0], SimulationWorld->GetCompanies()[1] };
+		Sides[0]->SetHostilityTo(Sides[1], true);
+		Sides[1]->SetHostilityTo(Sides[0], true);
+
+		for (int32 Side = 0; Side < 2; Side++)
+		{
+			for (int32 Type = 0; Type < 3; Type++)
+			{
+				for (int32 Index = 0; Index < BattleSpacecraftCounts[BattleIndex][Side][Type]; Index++)
+				{
+					Sector->CreateSpacecraft(BattleSpacecrafts[BattleIndex][Side][Type], Sides[Side], FVector::ZeroVector);
+				}
+			}
+		}
+
+		UFlareBattle* Battle = NewObject<UFlareBattle>(SimulationWorld, UFlareBattle::StaticClass());
+		Battle->Load(Sector);
+		Battle->SetLegacyResolver(Legacy);
+		Battle->Simulate();
+		TurnCount = Battle->GetTurnCount();
+
+		bool CanFight[2] = { false, false };
+		for (int32 SpacecraftIndex = 0; SpacecraftIndex < Sector->GetSectorSpacecrafts().Num(); SpacecraftIndex++)
+		{
+			UFlareSimulatedSpacecraft* Spacecraft = Sector->GetSectorSpacecrafts()[SpacecraftIndex];
+			if (Spacecraft->CanFight())
+			{
+				CanFight[Spacecraft->GetCompany() == Sides[0] ? 0 : 1] = true;
+			}
+		}
+		Outcome = (CanFight[0] == CanFight[1] ? 2 : (CanFight[0] ? 0 : 1));
+
+		GetGame()->Clean();
+	};
+
+	// Both resolvers play the same seeds, their results must agree within three standard errors
+	bool Passed = true;
+	for (int32 BattleIndex = 0; BattleIndex < BattleCount; BattleIndex++)
+	{
+		int32 OutcomeCounts[2][3] = { { 0, 0, 0 }, { 0, 0, 0 } };
+		float TurnSums[2] = { 0, 0 };
+		float TurnSquareSums[2] = { 0, 0 };
+
+		for (int32 Pass = 0; Pass < 2; Pass++)
+		{
+			for (int32 RunIndex = 0; RunIndex < RunCount; RunIndex++)
+			{
+				int32 Outcome;
+				int32 TurnCount;
+				PlayBattle(BattleIndex, (Pass == 0), RunIndex + 1, Outcome, TurnCount);
+
+				OutcomeCounts[Pass][Outcome]++;
+				TurnSums[Pass] += TurnCount;
+				TurnSquareSums[Pass] += FMath::Square(TurnCount);
+			}
+
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+
+		// Outcome frequencies : difference of proportions, with one battle of slack
+		bool BattlePassed = true;
+		for (int32 Outcome = 0; Outcome < 3; Outcome++)
+		{
+			float LegacyRatio = OutcomeCounts[0][Outcome] / (float) RunCount;
+			float CachedRatio = OutcomeCounts[1][Outcome] / (float) RunCount;
+			float PooledRatio = (LegacyRatio + CachedRatio) / 2;
+			float Tolerance = 3 * FMath::Sqrt(2 * PooledRatio * (1 - PooledRatio) / RunCount) + 1.f / RunCount;
+
+			if (FMath::Abs(LegacyRatio - CachedRatio) > Tolerance)
+			{
+				BattlePassed = false;
+			}
+		}
+
+		// Turn counts : difference of means, with half a turn of slack
+		float TurnMeans[2];
+		float TurnVariances[2];
+		for (int32 Pass = 0; Pass < 2; Pass++)
+		{
+			TurnMeans[Pass] = TurnSums[Pass] / RunCount;
+			TurnVariances[Pass] = FMath::Max(0.f, TurnSquareSums[Pass] / RunCount - FMath::Square(TurnMeans[Pass]));
+		}
+		float TurnTolerance = 3 * FMath::Sqrt((TurnVariances[0] + TurnVariances[1]) / RunCount) + 0.5f;
+
+		if (FMath::Abs(TurnMeans[0] - TurnMeans[1]) > TurnTolerance)
+		{
+			BattlePassed = false;
+		}
+
+		FLOGV("> CompareBattleResolvers: %s, %d battles : %s", BattleNames[BattleIndex], RunCount, (BattlePassed ? TEXT("PASSED") : TEXT("FAILED")));
+		FLOGV("   - outcomes (first side, second side, undecided) : legacy %d/%d/%d, cached %d/%d/%d",
+			OutcomeCounts[0][0], OutcomeCounts[0][1], OutcomeCounts[0][2], OutcomeCounts[1][0], OutcomeCounts[1][1], OutcomeCounts[1][2]);
+		FLOGV("   - turns : legacy %f, cached %f, tolerance %f", TurnMeans[0], TurnMeans[1], TurnTolerance);
+
+		Passed = Passed && BattlePassed;
+	}
+
+	ensureMsgf(Passed, TEXT("UFlareGameTools::CompareBattleResolvers : the battle resolvers disagree"));
+}
+
 
 void UFlareGameTools::GiveBirth(int32 SectorIndex, uint32 Population)
 {
@@ -75,6 +75,22 @@ public:
 	UFUNCTION(exec)
 	void SetFastFastForward(bool FFF);
 
+	/** Set the verbosity of a subsystem log category (AI, Economy, Travel, Combat, Save or All) */
+	UFUNCTION(exec)
+	void SetLogVerbosity(FName Subsystem, bool Verbose);
+
+	/** Print the subsystem log categories and the count of muted messages */
+	UFUNCTION(exec)
+	void PrintLogStatus();
+
+	/** Convert the binary game and combat logs to .decoded.log text files */
+	UFUNCTION(exec)
+	void DecodeLogFiles();
+
+	/** Compare each save made from cached data with a save encoded from scratch, and log differences */
+	UFUNCTION(exec)
+	void SetSaveCacheCheck(bool Check);
+
 	/*----------------------------------------------------
 		Company tools
 	----------------------------------------------------*/
@@ -183,6 +199,10 @@ public:
 	UFUNCTION(exec)
 	void PrintSectorByIndex(int32 Index);
 
+	/** Play synthetic battles with both battle resolvers in throwaway worlds, and check that their outcome and turn count distributions agree. Only available while no game is loaded */
+	UFUNCTION(exec)
+	void CompareBattleResolvers(int32 RunCount);
+
 	UFUNCTION(exec)
 	void GiveBirth(int32 SectorIndex, uint32 Population);
 
@@ -287,4 +307,6 @@ public:
 
 	static bool FastFastForward;
 
+	static bool SaveCacheCheck;
+
 };
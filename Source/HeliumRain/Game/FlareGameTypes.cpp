@@ -73,6 +73,7 @@ void FFlareFloatBuffer::Init(int32 Size)
 	MaxSize = Size;
 	Values.Empty(MaxSize);
 	WriteIndex = 0;
+	Sum = 0;
 }
 
 void FFlareFloatBuffer::Resize(int32 Size)
@@ -87,6 +88,7 @@ void FFlareFloatBuffer::Resize(int32 Size)
 		// Override
 		Values = NewValues;
 		WriteIndex = 0;
+		UpdateSum();
 	}
 
 	MaxSize = Size;
@@ -101,13 +103,19 @@ void FFlareFloatBuffer::Append(float NewValue)
 	}
 	else
 	{
+		Sum -= Values[WriteIndex];
 		Values[WriteIndex] = NewValue;
 		WriteIndex++;
 	}
 
+	Sum += NewValue;
+
 	if(WriteIndex >= MaxSize)
 	{
 		WriteIndex = 0;
+
+		// Once per cycle, drop the sum rounding errors
+		UpdateSum();
 	}
 }
 
@@ -135,7 +143,7 @@ float FFlareFloatBuffer::GetValue(int32 Age)
 float FFlareFloatBuffer::GetMean(int32 StartAge, int32 EndAge)
 {
 	float Count = 0.f;
-	float Sum = 0.f;
+	float ValueSum = 0.f;
 
 	if(StartAge >= Values.Num())
 	{
@@ -147,9 +155,15 @@ float FFlareFloatBuffer::GetMean(int32 StartAge, int32 EndAge)
 		EndAge = Values.Num() - 1;
 	}
 
+	// Mean of all values
+	if (StartAge == 0 && EndAge == Values.Num() - 1 && Values.Num() > 0)
+	{
+		return Sum / Values.Num();
+	}
+
 	for (int Age = StartAge; Age <= EndAge; Age++)
 	{
-		Sum += GetValue(Age);
+		ValueSum += GetValue(Age);
 		Count += 1.f;
 	}
 
@@ -157,7 +171,16 @@ float FFlareFloatBuffer::GetMean(int32 StartAge, int32 EndAge)
 	{
 		return 0.f;
 	}
-	return Sum/Count;
+	return ValueSum/Count;
+}
+
+void FFlareFloatBuffer::UpdateSum()
+{
+	Sum = 0;
+	for (int32 Index = 0; Index < Values.Num(); Index++)
+	{
+		Sum += Values[Index];
+	}
 }
 
 
@@ -272,12 +272,19 @@ struct FFlareCompanySave
 	int64 CompanyValue;
 };
 
-/** Game save data */
+/** Circular buffer of values */
 USTRUCT()
 struct FFlareFloatBuffer
 {
 	GENERATED_USTRUCT_BODY()
 
+	FFlareFloatBuffer()
+		: MaxSize(0)
+		, WriteIndex(0)
+		, Sum(0)
+	{
+	}
+
 	UPROPERTY(EditAnywhere, Category = Save)
 	int32 MaxSize;
 
@@ -287,6 +294,9 @@ struct FFlareFloatBuffer
 	UPROPERTY(EditAnywhere, Category = Save)
 	TArray<float> Values;
 
+	/** Sum of all stored values, maintained on append and not saved */
+	float Sum;
+
 
 	void Init(int32 Size);
 
@@ -297,6 +307,9 @@ struct FFlareFloatBuffer
 	float GetValue(int32 Age);
 
 	float GetMean(int32 StartAge, int32 EndAge);
+
+	/** Compute the sum of the stored values again */
+	void UpdateSum();
 };
 
 /** Incoming event description */
@@ -32,6 +32,7 @@ void UFlareGameUserSettings::SetToDefaults()
 	UseAnticollision = false;
 	PauseGameInMenus = false;
 	MaxShipsInSector = 50;
+	AIUpdateBudget = 10;
 
 	// Sound
 	MusicVolume = 8;
@@ -45,6 +46,16 @@ void UFlareGameUserSettings::ApplySettings(bool bCheckForCommandLineOverrides)
 	Super::ApplySettings(bCheckForCommandLineOverrides);
 
 	SetScreenPercentage(ScreenPercentage);
+
+	// Active sectors cache the AI budget
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		AFlareGame* Game = (Context.World() ? Cast<AFlareGame>(Context.World()->GetAuthGameMode()) : NULL);
+		if (Game && Game->GetActiveSector())
+		{
+			Game->GetActiveSector()->UpdateAIUpdateBudget();
+		}
+	}
 }
 
 void UFlareGameUserSettings::SetScreenPercentage(int32 NewScreenPercentage)
@@ -55,6 +55,10 @@ public:
 	/** Max ship count in a sector */
 	UPROPERTY(Config)
 	int32                                    MaxShipsInSector;
+
+	/** Max count of reduced-rate AI updates per frame, 0 to update all AI every frame */
+	UPROPERTY(Config)
+	int32                                    AIUpdateBudget;
 		
 	/** Music volume */
 	UPROPERTY(Config)
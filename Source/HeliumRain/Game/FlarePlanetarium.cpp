@@ -19,6 +19,9 @@ AFlarePlanetarium::AFlarePlanetarium(const class FObjectInitializer& PCIP)
 	TimeMultiplier = 1.0;
 	SkipNightTimeRange = 0;
 	Ready = false;
+	Sun = NULL;
+	CurrentParent = NULL;
+	PlayerRevolutionTime = 0;
 }
 
 void AFlarePlanetarium::BeginPlay()
@@ -102,22 +105,37 @@ void AFlarePlanetarium::Tick(float DeltaSeconds)
 
 			Ready = true;
 
+			UFlareSimulatedPlanetarium* Planetarium = World->GetPlanerarium();
+			if (PreparedPlanetarium != Planetarium)
+			{
+				PrepareCelestialBodies(Planetarium);
+			}
+
 			do
 			{
 
-				Sun = World->GetPlanerarium()->GetSnapShot(LocalTime, SmoothTime);
+				Sun = Planetarium->GetSnapShot(LocalTime, SmoothTime);
 
 				// Draw Player
 				FFlareSectorOrbitParameters* PlayerOrbit = GetGame()->GetActiveSector()->GetSimulatedSector()->GetOrbitParameters();
 
+				// The parent body and the player orbit only change with the sector
+				if (PreparedSector != CurrentSector)
+				{
+					CurrentParent = Planetarium->FindCelestialBody(PlayerOrbit->CelestialBodyIdentifier);
+					if (CurrentParent)
+					{
+						PlayerRevolutionTime = UFlareSimulatedPlanetarium::GetRevolutionTime(CurrentParent, CurrentParent->Radius + PlayerOrbit->Altitude, 0);
+					}
+					PreparedSector = CurrentSector;
+				}
 
-				FFlareCelestialBody* CurrentParent = World->GetPlanerarium()->FindCelestialBody(PlayerOrbit->CelestialBodyIdentifier);
 				if (CurrentParent)
 				{
 					FPreciseVector ParentLocation = CurrentParent->AbsoluteLocation;
 
 					double DistanceToParentCenter = CurrentParent->Radius + PlayerOrbit->Altitude;
-					FPreciseVector PlayerLocation =  ParentLocation + World->GetPlanerarium()->GetRelativeLocation(CurrentParent, LocalTime, SmoothTime, DistanceToParentCenter, 0, PlayerOrbit->Phase);
+					FPreciseVector PlayerLocation =  ParentLocation + UFlareSimulatedPlanetarium::GetOrbitLocation(PlayerRevolutionTime, LocalTime, SmoothTime, DistanceToParentCenter, PlayerOrbit->Phase);
 					/*FLOGV("Parent location = %s", *CurrentParent->AbsoluteLocation.ToString());
 					FLOGV("PlayerLocation = %s", *PlayerLocation.ToString());*/
 #ifdef PLANETARIUM_DEBUG
@@ -127,7 +145,7 @@ void AFlarePlanetarium::Tick(float DeltaSeconds)
 					DrawDebugLine(GetWorld(), FVector(0, 0, 900), FVector(0, 0, 1000), FColor::Cyan, false);
 #endif
 					FPreciseVector DeltaLocation = ParentLocation - PlayerLocation;
-					FPreciseVector SunDeltaLocation = Sun.AbsoluteLocation - PlayerLocation;
+					FPreciseVector SunDeltaLocation = Sun->AbsoluteLocation - PlayerLocation;
 
 					float AngleOffset =  90 + FMath::RadiansToDegrees(FMath::Atan2(DeltaLocation.Z,DeltaLocation.X));
 					/*FLOGV("DeltaLocation = %s", *DeltaLocation.ToString());
@@ -139,8 +157,7 @@ void AFlarePlanetarium::Tick(float DeltaSeconds)
 					SunOcclusion = 0;
 					MinDistance = DistanceToParentCenter;
 
-					BodyPositions.Empty();
-					PrepareCelestialBody(&Sun, -PlayerLocation, AngleOffset);
+					UpdateCelestialBodies(-PlayerLocation, AngleOffset);
 					SetupCelestialBodies();
 
 					if(SkipNightTimeRange > 0 && SunOcclusion >= 1)
@@ -198,8 +215,16 @@ inline static bool BodyDistanceComparator (const CelestialBodyPosition& ip1, con
 
 void AFlarePlanetarium::SetupCelestialBodies()
 {
-	// Sort by incresing distance
-	BodyPositions.Sort(&BodyDistanceComparator);
+	// Sort by incresing distance, when the order changed since the last frame
+	for (int32 BodyIndex = 1; BodyIndex < BodyPositions.Num(); BodyIndex++)
+	{
+		if (BodyPositions[BodyIndex].Distance < BodyPositions[BodyIndex - 1].Distance)
+		{
+			BodyPositions.Sort(&BodyDistanceComparator);
+			break;
+		}
+	}
+
 	double BaseDistance = GetGame()->GetActiveSector()->GetSectorLimits() * 2; // Min distance, 15km
 	double BaseIncrement = BaseDistance;
 #ifdef PLANETARIUM_DEBUG
@@ -289,41 +314,36 @@ void AFlarePlanetarium::SetupCelestialBody(CelestialBodyPosition* BodyPosition,
 	}
 	ComponentMaterial->SetVectorParameterValue("SunDirection", SunDirection.ToVector());
 
-	// Look for rings and orient them
-	TArray<USceneComponent*> RingCandidates;
-	BodyPosition->BodyComponent->GetChildrenComponents(true, RingCandidates);
-	for (int32 ComponentIndex = 0; ComponentIndex < RingCandidates.Num(); ComponentIndex++)
+	// Orient rings
+	for (int32 ComponentIndex = 0; ComponentIndex < BodyPosition->RingComponents.Num(); ComponentIndex++)
 	{
-		UStaticMeshComponent* RingComponent = Cast<UStaticMeshComponent>(RingCandidates[ComponentIndex]);
+		UStaticMeshComponent* RingComponent = BodyPosition->RingComponents[ComponentIndex];
 
-		if (RingComponent && RingComponent->GetName().Contains("ring"))
+		// Get or create the material
+		UMaterialInstanceDynamic* RingMaterial = Cast<UMaterialInstanceDynamic>(RingComponent->GetMaterial(0));
+		if (!RingMaterial)
 		{
-			// Get or create the material
-			UMaterialInstanceDynamic* RingMaterial = Cast<UMaterialInstanceDynamic>(RingComponent->GetMaterial(0));
-			if (!RingMaterial)
-			{
-				RingMaterial = UMaterialInstanceDynamic::Create(RingComponent->GetMaterial(0), GetWorld());
-				RingComponent->SetMaterial(0, RingMaterial);
-			}
+			RingMaterial = UMaterialInstanceDynamic::Create(RingComponent->GetMaterial(0), GetWorld());
+			RingComponent->SetMaterial(0, RingMaterial);
+		}
 
-			// Get world-space rotation angles for the ring and the sun
-			float SunRotationPitch = FMath::RadiansToDegrees(FMath::Atan2(SunDirection.Z,SunDirection.X)) + 180;
-			float RingRotationPitch = -BodyPosition->TotalRotation;
+		// Get world-space rotation angles for the ring and the sun
+		float SunRotationPitch = FMath::RadiansToDegrees(FMath::Atan2(SunDirection.Z,SunDirection.X)) + 180;
+		float RingRotationPitch = -BodyPosition->TotalRotation;
 
-			// Feed params to the shader
-			RingMaterial->SetScalarParameterValue("RingPitch", RingRotationPitch / 360);
-			RingMaterial->SetScalarParameterValue("SunPitch", SunRotationPitch / 360);
-		}
+		// Feed params to the shader
+		RingMaterial->SetScalarParameterValue("RingPitch", RingRotationPitch / 360);
+		RingMaterial->SetScalarParameterValue("SunPitch", SunRotationPitch / 360);
 	}
 
 	// Sun also rotates to track direction
-	if (BodyPosition->Body == &Sun)
+	if (BodyPosition->Body == Sun)
 	{
 		BodyPosition->BodyComponent->SetRelativeRotation(SunDirection.ToVector().Rotation());
 	}
 
 	// Compute sun occlusion
-	if (BodyPosition->Body != &Sun)
+	if (BodyPosition->Body != Sun)
 	{
 		double OcclusionAngle = FPreciseMath::Asin(BodyPosition->Radius / BodyPosition->Distance);
 
@@ -387,51 +407,79 @@ void AFlarePlanetarium::SetupCelestialBody(CelestialBodyPosition* BodyPosition,
 
 }
 
-void AFlarePlanetarium::PrepareCelestialBody(FFlareCelestialBody* Body, FPreciseVector Offset, double AngleOffset)
+void AFlarePlanetarium::PrepareCelestialBodies(UFlareSimulatedPlanetarium* Planetarium)
 {
-	CelestialBodyPosition BodyPosition;
+	BodyPositions.Empty();
+	PreparedPlanetarium = Planetarium;
+	PreparedSector = NAME_None;
+	CurrentParent = NULL;
 
-	BodyPosition.Body = Body;
-	FPreciseVector Location = Offset + Body->AbsoluteLocation;
-	BodyPosition.AlignedLocation = Location.RotateAngleAxis(AngleOffset, FPreciseVector(0,1,0));
-	BodyPosition.Radius = Body->Radius;
-	BodyPosition.Distance = BodyPosition.AlignedLocation.Size();
-	BodyPosition.TotalRotation = Body->RotationAngle + AngleOffset;
-
-	// Find the celestial body component
-	UStaticMeshComponent* BodyComponent = NULL;
 	TArray<UActorComponent*> Components = GetComponentsByClass(UStaticMeshComponent::StaticClass());
-	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	const TArray<FFlareCelestialBody*>& Bodies = Planetarium->GetBodies();
+
+	for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); BodyIndex++)
 	{
-		UStaticMeshComponent* ComponentCandidate = Cast<UStaticMeshComponent>(Components[ComponentIndex]);
-		if (ComponentCandidate && ComponentCandidate->GetName() == Body->Identifier.ToString()	)
+		FFlareCelestialBody* Body = Bodies[BodyIndex];
+
+		// Find the celestial body component
+		UStaticMeshComponent* BodyComponent = NULL;
+		for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
 		{
-			BodyComponent = ComponentCandidate;
-			break;
+			UStaticMeshComponent* ComponentCandidate = Cast<UStaticMeshComponent>(Components[ComponentIndex]);
+			if (ComponentCandidate && ComponentCandidate->GetName() == Body->Identifier.ToString()	)
+			{
+				BodyComponent = ComponentCandidate;
+				break;
+			}
 		}
-	}
 
-	if (BodyComponent)
-	{
-		BodyPosition.BodyComponent = BodyComponent;
-		BodyPositions.Add(BodyPosition);
-	}
-	else
-	{
-		FLOGV("AFlarePlanetarium::PrepareCelestialBody : no planetarium component for celestial body '%s'", *(Body->Identifier.ToString()));
+		if (BodyComponent)
+		{
+			CelestialBodyPosition BodyPosition;
+			BodyPosition.Body = Body;
+			BodyPosition.BodyComponent = BodyComponent;
+			BodyPosition.Distance = 0;
+			BodyPosition.Radius = Body->Radius;
+			BodyPosition.TotalRotation = 0;
+
+			// Look for rings
+			TArray<USceneComponent*> RingCandidates;
+			BodyComponent->GetChildrenComponents(true, RingCandidates);
+			for (int32 ComponentIndex = 0; ComponentIndex < RingCandidates.Num(); ComponentIndex++)
+			{
+				UStaticMeshComponent* RingComponent = Cast<UStaticMeshComponent>(RingCandidates[ComponentIndex]);
+				if (RingComponent && RingComponent->GetName().Contains("ring"))
+				{
+					BodyPosition.RingComponents.Add(RingComponent);
+				}
+			}
+
+			BodyPositions.Add(BodyPosition);
+		}
+		else
+		{
+			FLOGV("AFlarePlanetarium::PrepareCelestialBodies : no planetarium component for celestial body '%s'", *(Body->Identifier.ToString()));
+		}
 	}
+}
 
+void AFlarePlanetarium::UpdateCelestialBodies(FPreciseVector Offset, double AngleOffset)
+{
+	// The sun is needed for occlusion even without component
+	FPreciseVector SunLocation = (Offset + Sun->AbsoluteLocation).RotateAngleAxis(AngleOffset, FPreciseVector(0,1,0));
+	SunOcclusionAngle = FPreciseMath::Asin(Sun->Radius / SunLocation.Size());
+	SunPhase = FMath::UnwindRadians(FMath::Atan2(SunLocation.Z, SunLocation.X));
 
-	if (Body == &Sun)
+	for (int32 BodyIndex = 0; BodyIndex < BodyPositions.Num(); BodyIndex++)
 	{
-		SunOcclusionAngle = FPreciseMath::Asin(BodyPosition.Radius / BodyPosition.Distance);
-		SunPhase = FMath::UnwindRadians(FMath::Atan2(BodyPosition.AlignedLocation.Z, BodyPosition.AlignedLocation.X));
-	}
+		CelestialBodyPosition* BodyPosition = &BodyPositions[BodyIndex];
+		FFlareCelestialBody* Body = BodyPosition->Body;
 
-	for (int SatteliteIndex = 0; SatteliteIndex < Body->Sattelites.Num(); SatteliteIndex++)
-	{
-		FFlareCelestialBody* CelestialBody = &Body->Sattelites[SatteliteIndex];
-		PrepareCelestialBody(CelestialBody, Offset, AngleOffset);
+		FPreciseVector Location = Offset + Body->AbsoluteLocation;
+		BodyPosition->AlignedLocation = Location.RotateAngleAxis(AngleOffset, FPreciseVector(0,1,0));
+		BodyPosition->Radius = Body->Radius;
+		BodyPosition->Distance = BodyPosition->AlignedLocation.Size();
+		BodyPosition->TotalRotation = Body->RotationAngle + AngleOffset;
 	}
 }
 
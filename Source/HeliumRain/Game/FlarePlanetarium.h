@@ -13,6 +13,7 @@ struct CelestialBodyPosition
 	double Radius;
 	double TotalRotation;
 	FPreciseVector AlignedLocation;
+	TArray<UStaticMeshComponent*> RingComponents;
 };
 
 
@@ -33,8 +34,11 @@ public:
 
 	void BeginPlay() override;
 
-	/** Prepare a celestial body to future setup */
-	void PrepareCelestialBody(FFlareCelestialBody* Body, FPreciseVector Offset, double AngleOffset);
+	/** Find the components of all celestial bodies of a planetarium */
+	void PrepareCelestialBodies(UFlareSimulatedPlanetarium* Planetarium);
+
+	/** Update the aligned location of all celestial bodies for future setup */
+	void UpdateCelestialBodies(FPreciseVector Offset, double AngleOffset);
 
 	void SetupCelestialBodies();
 
@@ -81,7 +85,13 @@ protected:
 
 	FName CurrentSector;
 
-	FFlareCelestialBody Sun;
+	const FFlareCelestialBody* Sun;
+
+	// Bodies are prepared once per planetarium, the current parent once per sector
+	TWeakObjectPtr<UFlareSimulatedPlanetarium> PreparedPlanetarium;
+	FName PreparedSector;
+	FFlareCelestialBody* CurrentParent;
+	int64 PlayerRevolutionTime;
 
 	double SunOcclusion;
 	double MinDistance;
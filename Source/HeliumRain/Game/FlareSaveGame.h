@@ -118,5 +118,14 @@ public:
 
 	UPROPERTY(VisibleAnywhere, Category = Save)
 	int32 CurrentIdentifierIndex;
+
+
+	/*----------------------------------------------------
+		Save revisions, not saved
+	----------------------------------------------------*/
+
+	TMap<FName, uint64>                             CompanyRevisions;
+	TMap<FName, uint64>                             SectorRevisions;
+	TMap<FName, uint64>                             SpacecraftRevisions;
 };
 
@@ -456,6 +456,7 @@ void UFlareScenarioTools::CreateStations(FName StationClass, UFlareCompany* Comp
 		}
 
 		Station->GetData().Level = Level;
+		Station->SetDirty();
 
 		if (Station->GetFactories().Num() > 0)
 		{
@@ -5,6 +5,30 @@
 #include "FlareCollider.h"
 #include "../Spacecrafts/FlareSpacecraft.h"
 #include "../Player/FlarePlayerController.h"
+#include "../Quests/FlareQuestManager.h"
+#include "FlareGameUserSettings.h"
+#include "../Data/FlareCatalogLoader.h"
+#include "../Data/FlareSpacecraftComponentsCatalog.h"
+#include "Log/FlareLogApi.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("FlareSector AI updates"), STAT_FlareSector_AIUpdates, STATGROUP_Flare);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FlareSector AI deferred updates"), STAT_FlareSector_AIDeferredUpdates, STATGROUP_Flare);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FlareSector AI update budget"), STAT_FlareSector_AIUpdateBudget, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlareSector UpdateAnticollision"), STAT_FlareSector_UpdateAnticollision, STATGROUP_Flare);
+
+#define AI_LOD_NEAR_DISTANCE 500000 // 5 km
+#define AI_LOD_FAR_DISTANCE 2000000 // 20 km
+#define AI_LOD_DAMAGE_DELAY 10 // 10 s
+
+#define BROAD_PHASE_CELL_SIZE 100000 // 1 km
+
+#define OCCUPANCY_CELL_SIZE 200000 // 2 km
+#define OCCUPANCY_MAX_CELLS 8
+
+#define ANTICOLLISION_HORIZON 5.0f // Same as PilotHelper::CheckRelativeDangerosity
+
+#define ACTIVATION_NEAR_DISTANCE 500000 // 5 km
+#define ACTIVATION_FRAME_BUDGET 0.002 // 2 ms
 
 
 /*----------------------------------------------------
@@ -16,6 +40,21 @@ UFlareSector::UFlareSector(const FObjectInitializer& ObjectInitializer)
 {
 	SectorRepartitionCache = false;
 	IsDestroyingSector = false;
+	AIUpdateFrame = 0;
+	AIUpdateCount = 0;
+	AIUpdateBudget = 0;
+	BroadPhaseFrame = 0;
+	AnticollisionFrame = 0;
+	BodyBoundsFrame = 0;
+	AnticollisionMaxSpeed = 0;
+	AnticollisionMaxSize = 0;
+	ActivationIndex = 0;
+	ActivationSafeCount = 0;
+	ActivationComplete = true;
+	ActivationPlayerShipFlown = false;
+	ActivationStartTime = 0;
+	ActivationFirstFrameDuration = 0;
+	ActivationFrameCount = 0;
 }
 
 /*----------------------------------------------------
@@ -27,6 +66,28 @@ void UFlareSector::Load(UFlareSimulatedSector* Parent)
 	DestroySector();
 	ParentSector = Parent;
 	LocalTime = Parent->GetData()->LocalTime;
+	UpdateAIUpdateBudget();
+	ActivationStartTime = FPlatformTime::Seconds();
+	ActivationFrameCount = 1;
+	ActivationComplete = false;
+	ActivationPlayerShipFlown = false;
+
+	// Colliders are part of the level, registered by the game, and never move
+	const TArray<AFlareCollider*>& Colliders = GetGame()->GetColliders();
+	for (int32 ColliderIndex = 0; ColliderIndex < Colliders.Num(); ColliderIndex++)
+	{
+		AFlareCollider* Collider = Colliders[ColliderIndex];
+
+		FFlareAnticollisionObstacle Obstacle;
+		Obstacle.Actor = Collider;
+		Obstacle.Location = Collider->GetActorLocation();
+		Obstacle.Velocity = FVector::ZeroVector;
+		Obstacle.Size = Collider->GetColliderRadius();
+
+		SectorColliders.Add(Collider);
+		ColliderObstacles.Add(Obstacle);
+		RegisterBody(Collider, Obstacle.Size, false);
+	}
 
 	// Load asteroids
 	for (int i = 0 ; i < ParentSector->GetData()->AsteroidData.Num(); i++)
@@ -34,52 +95,258 @@ void UFlareSector::Load(UFlareSimulatedSector* Parent)
 		LoadAsteroid(ParentSector->GetData()->AsteroidData[i]);
 	}
 
-	// Load safe location spacecrafts
+	// Sort spacecrafts to load : safe location spacecrafts by distance to the player, then unsafe ones that will be placed around them
+	UFlareSimulatedSpacecraft* PlayerShip = Parent->GetGame()->GetPC()->GetPlayerShip();
+	bool PlayerShipSafe = false;
+	TArray<UFlareSimulatedSpacecraft*> UnsafeSpacecrafts;
 	for (int i = 0 ; i < ParentSector->GetSectorSpacecrafts().Num(); i++)
 	{
 		UFlareSimulatedSpacecraft* Spacecraft = ParentSector->GetSectorSpacecrafts()[i];
-		if (Spacecraft->GetData().SpawnMode == EFlareSpawnMode::Safe && (!Spacecraft->IsReserve() ||  Parent->GetGame()->GetPC()->GetPlayerShip() == Spacecraft))
+		if (Spacecraft == PlayerShip || Spacecraft->IsReserve())
 		{
-			LoadSpacecraft(Spacecraft);
+			continue;
+		}
+		else if (Spacecraft->GetData().SpawnMode == EFlareSpawnMode::Safe)
+		{
+			ActivationQueue.Add(Spacecraft);
+		}
+		else
+		{
+			UnsafeSpacecrafts.Add(Spacecraft);
 		}
 	}
 
-	SectorRepartitionCache = false;
+	// The player ship comes first when its location is known, else it is the first to be placed once all safe spacecrafts exist
+	FVector PlayerLocation = FVector::ZeroVector;
+	if (PlayerShip && PlayerShip->GetCurrentSector() == ParentSector)
+	{
+		if (PlayerShip->GetData().SpawnMode == EFlareSpawnMode::Safe)
+		{
+			PlayerShipSafe = true;
+			PlayerLocation = PlayerShip->GetData().Location;
+			ActivationQueue.Insert(PlayerShip, 0);
+		}
+		else
+		{
+			UnsafeSpacecrafts.Insert(PlayerShip, 0);
+		}
+	}
 
-	// Load unsafe location spacecrafts
-	for (int i = 0; i < ParentSector->GetSectorSpacecrafts().Num(); i++)
+	ActivationQueue.StableSort([=](const UFlareSimulatedSpacecraft& A, const UFlareSimulatedSpacecraft& B)
 	{
-		UFlareSimulatedSpacecraft* Spacecraft = ParentSector->GetSectorSpacecrafts()[i];
-		if (Spacecraft->GetData().SpawnMode != EFlareSpawnMode::Safe && (!Spacecraft->IsReserve() ||  Parent->GetGame()->GetPC()->GetPlayerShip() == Spacecraft))
+		if (&A == PlayerShip || &B == PlayerShip)
+		{
+			return (&A == PlayerShip);
+		}
+		return (A.GetData().Location - PlayerLocation).SizeSquared() < (B.GetData().Location - PlayerLocation).SizeSquared();
+	});
+	ActivationSafeCount = ActivationQueue.Num();
+	ActivationQueue.Append(UnsafeSpacecrafts);
+	PreloadActivationAssets();
+
+	// Spawn the safe player ship and nearby spacecrafts right now
+	ActivationIndex = 0;
+	while (ActivationIndex < ActivationQueue.Num())
+	{
+		UFlareSimulatedSpacecraft* Spacecraft = ActivationQueue[ActivationIndex];
+		bool IsNear = (Spacecraft->GetData().SpawnMode == EFlareSpawnMode::Safe
+			&& (Spacecraft->GetData().Location - PlayerLocation).SizeSquared() < FMath::Square(ACTIVATION_NEAR_DISTANCE));
+
+		if (!IsNear && !(PlayerShipSafe && Spacecraft == PlayerShip))
+		{
+			break;
+		}
+
+		ActivateSpacecraft(Spacecraft);
+		ActivationIndex++;
+	}
+
+	ActivationFirstFrameDuration = FPlatformTime::Seconds() - ActivationStartTime;
+
+	if (ActivationIndex >= ActivationQueue.Num())
+	{
+		FinishActivation();
+	}
+}
+
+void UFlareSector::UpdateActivation()
+{
+	if (ActivationComplete)
+	{
+		return;
+	}
+
+	// Spawn spacecrafts as their assets finish loading, as many as the budget allows
+	double FrameStartTime = FPlatformTime::Seconds();
+	ActivationFrameCount++;
+	while (ActivationIndex < ActivationQueue.Num())
+	{
+		if (!AreSpacecraftAssetsLoaded(ActivationQueue[ActivationIndex]))
+		{
+			break;
+		}
+
+		ActivateSpacecraft(ActivationQueue[ActivationIndex]);
+		ActivationIndex++;
+
+		if (FPlatformTime::Seconds() - FrameStartTime > ACTIVATION_FRAME_BUDGET)
+		{
+			break;
+		}
+	}
+
+	if (ActivationIndex >= ActivationQueue.Num())
+	{
+		FinishActivation();
+	}
+}
+
+void UFlareSector::PreloadActivationAssets()
+{
+	TArray<FStringAssetReference> Assets;
+	for (int i = 0; i < ActivationQueue.Num(); i++)
+	{
+		GetSpacecraftAssets(ActivationQueue[i], Assets);
+	}
+
+	if (Assets.Num())
+	{
+		FFlareCatalogLoader::PreloadAssets(Assets, FStreamableDelegate());
+	}
+}
+
+void UFlareSector::GetSpacecraftAssets(UFlareSimulatedSpacecraft* ParentSpacecraft, TArray<FStringAssetReference>& Assets)
+{
+	FFlareSpacecraftDescription* Description = ParentSpacecraft->GetDescription();
+	if (!Description->Template.IsNull())
+	{
+		Assets.AddUnique(Description->Template.ToStringReference());
+	}
+
+	for (int i = 0; i < Description->DynamicComponentStates.Num(); i++)
+	{
+		const TArray<TAssetPtr<UBlueprint>>& StateTemplates = Description->DynamicComponentStates[i].StateTemplates;
+		for (int j = 0; j < StateTemplates.Num(); j++)
 		{
-			LoadSpacecraft(Spacecraft);
+			if (!StateTemplates[j].IsNull())
+			{
+				Assets.AddUnique(StateTemplates[j].ToStringReference());
+			}
 		}
 	}
 
-	// Check docking once all spacecraft are loaded
-	for (int i = 0; i < SectorSpacecrafts.Num(); i++)
+	const TArray<FFlareSpacecraftComponentSave>& Components = ParentSpacecraft->GetData().Components;
+	for (int i = 0; i < Components.Num(); i++)
 	{
-		SectorSpacecrafts[i]->Redock();
+		FFlareSpacecraftComponentDescription* ComponentDescription = GetGame()->GetShipPartsCatalog()->Get(Components[i].ComponentIdentifier);
+		if (ComponentDescription && !ComponentDescription->Mesh.IsNull())
+		{
+			Assets.AddUnique(ComponentDescription->Mesh.ToStringReference());
+		}
+	}
+}
+
+bool UFlareSector::AreSpacecraftAssetsLoaded(UFlareSimulatedSpacecraft* ParentSpacecraft)
+{
+	TArray<FStringAssetReference> Assets;
+	GetSpacecraftAssets(ParentSpacecraft, Assets);
+
+	for (int i = 0; i < Assets.Num(); i++)
+	{
+		if (!FFlareCatalogLoader::IsAssetLoaded(Assets[i]))
+		{
+			return false;
+		}
 	}
+	return true;
+}
 
+void UFlareSector::ActivateSpacecraft(UFlareSimulatedSpacecraft* ParentSpacecraft)
+{
+	// Unsafe spacecrafts come last, place them around all the safe ones
+	if (ActivationIndex == ActivationSafeCount)
+	{
+		FillOccupancy(NULL);
+	}
+
+	// The spacecraft may have left the sector while waiting
+	if (ParentSpacecraft->GetCurrentSector() != ParentSector || ParentSpacecraft->IsActive())
+	{
+		return;
+	}
+
+	AFlareSpacecraft* Spacecraft = LoadSpacecraft(ParentSpacecraft);
+	if (!Spacecraft)
+	{
+		return;
+	}
+
+	// Dock to an active station
+	Spacecraft->Redock();
+
+	// Dock active ships to this station
+	if (Spacecraft->IsStation())
+	{
+		for (int i = 0; i < SectorShips.Num(); i++)
+		{
+			if (SectorShips[i]->GetData().DockedTo == Spacecraft->GetImmatriculation())
+			{
+				SectorShips[i]->Redock();
+			}
+		}
+	}
+
+	// Fly the player ship as soon as it exists, so that the player controller is never left without a ship
+	if (ParentSpacecraft == GetGame()->GetPC()->GetPlayerShip())
+	{
+		ActivationPlayerShipFlown = true;
+		GetGame()->GetPC()->OnSectorActivated(this);
+	}
+}
+
+void UFlareSector::FinishActivation()
+{
 	// Load bombs
 	for (int i = 0; i < ParentSector->GetData()->BombData.Num(); i++)
 	{
 		LoadBomb(ParentSector->GetData()->BombData[i]);
 	}
+
+	ActivationComplete = true;
+	ActivationQueue.Empty();
+	SectorRepartitionCache = false;
+	OccupancySpheres.Empty();
+	OccupancyCells.Empty();
+	OccupancyLargeSpheres.Empty();
+
+	// Report timing
+	double TotalDuration = FPlatformTime::Seconds() - ActivationStartTime;
+	FLOGV("UFlareSector::FinishActivation : %d spacecrafts in %d frames, first frame %f ms, total %f ms",
+		SectorSpacecrafts.Num(), ActivationFrameCount, ActivationFirstFrameDuration * 1000, TotalDuration * 1000);
+	CombatLog::SectorActivated(ParentSector, SectorSpacecrafts.Num(), ActivationFrameCount, ActivationFirstFrameDuration * 1000, TotalDuration * 1000);
+
+	// All spacecrafts exist now, let the player pick one if its ship isn't here, and let quests use them
+	if (!ActivationPlayerShipFlown)
+	{
+		GetGame()->GetPC()->OnSectorActivated(this);
+	}
+	GetGame()->GetQuestManager()->OnSectorActivation(ParentSector);
 }
 
 void UFlareSector::Save()
 {
 	FFlareSectorSave* SectorData  = GetSimulatedSector()->GetData();
 
-	SectorData->BombData.Empty();
 	SectorData->AsteroidData.Empty();
 
-
-	for (int i = 0 ; i < SectorBombs.Num(); i++)
+	// Bombs are loaded at the end of the activation, keep the saved ones until then
+	if (ActivationComplete)
 	{
-		SectorData->BombData.Add(*SectorBombs[i]->Save());
+		SectorData->BombData.Empty();
+		for (int i = 0 ; i < SectorBombs.Num(); i++)
+		{
+			SectorData->BombData.Add(*SectorBombs[i]->Save());
+		}
 	}
 
 	for (int i = 0 ; i < SectorAsteroids.Num(); i++)
@@ -96,10 +363,10 @@ void UFlareSector::DestroySector()
 
 	IsDestroyingSector = true;
 
-	// Remove spacecrafts from world
+	// Remove spacecrafts from world, keeping them for the next sector
 	for (int SpacecraftIndex = 0 ; SpacecraftIndex < SectorSpacecrafts.Num(); SpacecraftIndex++)
 	{
-		SectorSpacecrafts[SpacecraftIndex]->Destroy();
+		GetGame()->ReleaseSpacecraft(SectorSpacecrafts[SpacecraftIndex]);
 	}
 
 	for (int BombIndex = 0 ; BombIndex < SectorBombs.Num(); BombIndex++)
@@ -109,7 +376,7 @@ void UFlareSector::DestroySector()
 
 	for (int AsteroidIndex = 0 ; AsteroidIndex < SectorAsteroids.Num(); AsteroidIndex++)
 	{
-		SectorAsteroids[AsteroidIndex]->Destroy();
+		GetGame()->ReleaseAsteroid(SectorAsteroids[AsteroidIndex]);
 	}
 
 	for (int ShellIndex = 0 ; ShellIndex < SectorShells.Num(); ShellIndex++)
@@ -120,9 +387,19 @@ void UFlareSector::DestroySector()
 	SectorSpacecrafts.Empty();
 	SectorShips.Empty();
 	SectorStations.Empty();
+	CompanyShipIndex.Empty();
+	CompanySpacecraftIndex.Empty();
+	SpacecraftImmatriculationIndex.Empty();
 	SectorBombs.Empty();
 	SectorAsteroids.Empty();
 	SectorShells.Empty();
+	SectorColliders.Empty();
+	ColliderObstacles.Empty();
+	BodyBounds.Empty();
+	BodyBoundsFrame = 0;
+	AnticollisionFrame = 0;
+	ActivationQueue.Empty();
+	ActivationComplete = true;
 
 	IsDestroyingSector = false;
 }
@@ -138,11 +415,18 @@ AFlareAsteroid* UFlareSector::LoadAsteroid(const FFlareAsteroidSave& AsteroidDat
     Params.bNoFail = true;
 	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-	AFlareAsteroid* Asteroid = GetGame()->GetWorld()->SpawnActor<AFlareAsteroid>(AFlareAsteroid::StaticClass(), AsteroidData.Location, AsteroidData.Rotation, Params);
+	AFlareAsteroid* Asteroid = GetGame()->AcquireAsteroid(AsteroidData.Location, AsteroidData.Rotation);
+	if (!Asteroid)
+	{
+		Asteroid = GetGame()->GetWorld()->SpawnActor<AFlareAsteroid>(AFlareAsteroid::StaticClass(), AsteroidData.Location, AsteroidData.Rotation, Params);
+	}
     Asteroid->Load(AsteroidData);
 
 	// TODO Check double add
 	SectorAsteroids.Add(Asteroid);
+
+	FBox AsteroidBox = Asteroid->GetComponentsBoundingBox();
+	RegisterBody(Asteroid, FMath::Max(AsteroidBox.GetExtent().Size(), 1.0f), true);
     return Asteroid;
 }
 
@@ -156,8 +440,13 @@ AFlareSpacecraft* UFlareSector::LoadSpacecraft(UFlareSimulatedSpacecraft* Parent
 	Params.bNoFail = true;
 	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-	// Create and configure the ship
-	Spacecraft = GetGame()->GetWorld()->SpawnActor<AFlareSpacecraft>(ParentSpacecraft->GetDescription()->Template->GeneratedClass, ParentSpacecraft->GetData().Location, ParentSpacecraft->GetData().Rotation, Params);
+	// Create and configure the ship, reusing a released actor of the same class if possible
+	UClass* SpacecraftClass = ParentSpacecraft->GetDescription()->GetTemplate()->GeneratedClass;
+	Spacecraft = GetGame()->AcquireSpacecraft(SpacecraftClass, ParentSpacecraft->GetData().Location, ParentSpacecraft->GetData().Rotation);
+	if (!Spacecraft)
+	{
+		Spacecraft = GetGame()->GetWorld()->SpawnActor<AFlareSpacecraft>(SpacecraftClass, ParentSpacecraft->GetData().Location, ParentSpacecraft->GetData().Rotation, Params);
+	}
 	if (Spacecraft && !Spacecraft->IsPendingKillPending())
 	{
 		Spacecraft->Load(ParentSpacecraft);
@@ -170,8 +459,11 @@ AFlareSpacecraft* UFlareSector::LoadSpacecraft(UFlareSimulatedSpacecraft* Parent
 		else
 		{
 			SectorShips.Add(Spacecraft);
+			CompanyShipIndex.FindOrAdd(Spacecraft->GetCompany()).Add(Spacecraft);
 		}
 		SectorSpacecrafts.Add(Spacecraft);
+		CompanySpacecraftIndex.FindOrAdd(Spacecraft->GetCompany()).Add(Spacecraft);
+		SpacecraftImmatriculationIndex.Add(Spacecraft->GetImmatriculation(), Spacecraft);
 
 		switch (ParentSpacecraft->GetData().SpawnMode)
 		{
@@ -210,7 +502,7 @@ AFlareSpacecraft* UFlareSector::LoadSpacecraft(UFlareSimulatedSpacecraft* Parent
 					ParentSpacecraft->GetData().Location.X, ParentSpacecraft->GetData().Location.Y, ParentSpacecraft->GetData().Location.Z);
 
 				FVector SpawnDirection;
-				TArray<AFlareSpacecraft*> FriendlySpacecrafts = GetCompanySpacecrafts(Spacecraft->GetCompany());
+				const TArray<AFlareSpacecraft*>& FriendlySpacecrafts = GetCompanySpacecrafts(Spacecraft->GetCompany());
 				FVector FriendlyShipLocationSum = FVector::ZeroVector;
 				int FriendlyShipCount = 0;
 
@@ -303,6 +595,12 @@ AFlareSpacecraft* UFlareSector::LoadSpacecraft(UFlareSimulatedSpacecraft* Parent
 			break;
 		}
 
+		// Following spacecrafts of this activation will be placed around this one
+		if (IsActivating() && ParentSpacecraft->GetData().SpawnMode != EFlareSpawnMode::Safe)
+		{
+			AddOccupancy(Spacecraft->GetActorLocation(), Spacecraft->GetMeshScale());
+		}
+
 		ParentSpacecraft->SetSpawnMode(EFlareSpawnMode::Safe);
 	}
 	else
@@ -448,33 +746,15 @@ AActor* UFlareSector::GetNearestBody(FVector Location, float* NearestDistance, b
 		}
 	}
 
-	for (int32 AsteroidIndex = 0; AsteroidIndex < GetAsteroids().Num(); AsteroidIndex++)
+	const TArray<FFlareBodyBounds>& Bodies = GetBodyBounds();
+	for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); BodyIndex++)
 	{
-		AFlareAsteroid* AsteroidCandidate = GetAsteroids()[AsteroidIndex];
-
-		FBox CandidateBox = AsteroidCandidate->GetComponentsBoundingBox();
-		float CandidateSize = FMath::Max(CandidateBox.GetExtent().Size(), 1.0f);
+		const FFlareBodyBounds& BodyCandidate = Bodies[BodyIndex];
 
-		float Distance = FVector::Dist(AsteroidCandidate->GetActorLocation(), Location) - CandidateSize;
-		if (AsteroidCandidate != ActorToIgnore && (!NearestCandidateActor || NearestCandidateActorDistance > Distance))
+		float Distance = FVector::Dist(BodyCandidate.Location, Location) - BodyCandidate.Size;
+		if (BodyCandidate.Actor != ActorToIgnore && (!NearestCandidateActor || NearestCandidateActorDistance > Distance))
 		{
-			NearestCandidateActor = AsteroidCandidate;
-			NearestCandidateActorDistance = Distance;
-		}
-	}
-
-	TArray<AActor*> ColliderActorList;
-	UGameplayStatics::GetAllActorsOfClass(GetGame()->GetWorld(), AFlareCollider::StaticClass(), ColliderActorList);
-	for (int32 ColliderIndex = 0; ColliderIndex < ColliderActorList.Num(); ColliderIndex++)
-	{
-		AActor* ColliderCandidate = ColliderActorList[ColliderIndex];
-
-		float CandidateSize = Cast<UStaticMeshComponent>(ColliderCandidate->GetRootComponent())->Bounds.SphereRadius;
-
-		float Distance = FVector::Dist(ColliderCandidate->GetActorLocation(), Location) - CandidateSize;
-		if (ColliderCandidate != ActorToIgnore && (!NearestCandidateActor || NearestCandidateActorDistance > Distance))
-		{
-			NearestCandidateActor = ColliderCandidate;
+			NearestCandidateActor = BodyCandidate.Actor;
 			NearestCandidateActorDistance = Distance;
 		}
 	}
@@ -487,73 +767,479 @@ void UFlareSector::PlaceSpacecraft(AFlareSpacecraft* Spacecraft, FVector Locatio
 {
 	float RandomLocationRadiusIncrement = 80000; // 800m
 	float RandomLocationRadius = RandomLocationRadiusIncrement;
-	float EffectiveDistance = -1;
+	float Size = Spacecraft->GetMeshScale();
+
+	// Outside of activation, spacecrafts have moved since they were placed
+	if (!IsActivating())
+	{
+		FillOccupancy(Spacecraft);
+	}
 
 	do 
 	{
 		Location += FMath::VRand() * RandomLocationRadius;
-		float Size = Spacecraft->GetMeshScale();
-		float NearestDistance;
 
 		// Check if location is secure
-		if (GetNearestBody(Location, &NearestDistance, true, Spacecraft) == NULL)
+		if (!IsOccupied(Location, Size))
 		{
-			// No other ship.
 			break;
 		}
 
-		EffectiveDistance = NearestDistance - Size;
 		RandomLocationRadius += RandomLocationRadiusIncrement;
 	}
-	while (EffectiveDistance <= 0 && RandomLocationRadius < RandomLocationRadiusIncrement * 1000);
+	while (RandomLocationRadius < RandomLocationRadiusIncrement * 1000);
 
 	Spacecraft->SetActorLocation(Location);
 }
 
-/*----------------------------------------------------
-	Getters
-----------------------------------------------------*/
+const TArray<FFlareBodyBounds>& UFlareSector::GetBodyBounds()
+{
+	// Asteroids drift slowly, their bounds are computed once but their location is updated each frame
+	if (BodyBoundsFrame != GFrameCounter)
+	{
+		BodyBoundsFrame = GFrameCounter;
+		for (int32 BodyIndex = 0; BodyIndex < BodyBounds.Num(); BodyIndex++)
+		{
+			FFlareBodyBounds& Body = BodyBounds[BodyIndex];
+			if (Body.Movable)
+			{
+				Body.Location = Body.Actor->GetActorLocation();
+			}
+		}
+	}
+
+	return BodyBounds;
+}
 
-TArray<AFlareSpacecraft*> UFlareSector::GetCompanyShips(UFlareCompany* Company)
+void UFlareSector::RegisterBody(AActor* Body, float Size, bool Movable)
 {
-	TArray<AFlareSpacecraft*> CompanyShips;
-	// TODO Cache
+	FFlareBodyBounds Bounds;
+	Bounds.Actor = Body;
+	Bounds.Location = Body->GetActorLocation();
+	Bounds.Size = Size;
+	Bounds.Movable = Movable;
+
+	BodyBounds.Add(Bounds);
+	BodyBoundsFrame = 0;
+}
 
-	for (int i = 0 ; i < SectorShips.Num(); i++)
+void UFlareSector::ResetOccupancy()
+{
+	OccupancySpheres.Reset();
+	OccupancyCells.Reset();
+	OccupancyLargeSpheres.Reset();
+
+	const TArray<FFlareBodyBounds>& Bodies = GetBodyBounds();
+	for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); BodyIndex++)
+	{
+		AddOccupancy(Bodies[BodyIndex].Location, Bodies[BodyIndex].Size);
+	}
+}
+
+void UFlareSector::FillOccupancy(AFlareSpacecraft* IgnoredSpacecraft)
+{
+	ResetOccupancy();
+
+	for (int32 SpacecraftIndex = 0; SpacecraftIndex < SectorSpacecrafts.Num(); SpacecraftIndex++)
 	{
-		if (SectorShips[i]->GetCompany() == Company)
+		AFlareSpacecraft* SpacecraftCandidate = SectorSpacecrafts[SpacecraftIndex];
+		if (SpacecraftCandidate != IgnoredSpacecraft)
 		{
-			CompanyShips.Add(SectorShips[i]);
+			AddOccupancy(SpacecraftCandidate->GetActorLocation(), SpacecraftCandidate->GetMeshScale());
 		}
 	}
-	return CompanyShips;
 }
 
-TArray<AFlareSpacecraft*> UFlareSector::GetCompanySpacecrafts(UFlareCompany* Company)
+void UFlareSector::AddOccupancy(FVector Location, float Radius)
 {
-	TArray<AFlareSpacecraft*> CompanySpacecrafts;
-	// TODO Cache
+	int32 SphereIndex = OccupancySpheres.Add(FSphere(Location, Radius));
+	FIntVector MinCell = GetOccupancyCell(Location - FVector(Radius));
+	FIntVector MaxCell = GetOccupancyCell(Location + FVector(Radius));
 
-	for (int i = 0 ; i < SectorSpacecrafts.Num(); i++)
+	// Huge bodies are always tested
+	if (MaxCell.X - MinCell.X >= OCCUPANCY_MAX_CELLS || MaxCell.Y - MinCell.Y >= OCCUPANCY_MAX_CELLS || MaxCell.Z - MinCell.Z >= OCCUPANCY_MAX_CELLS)
+	{
+		OccupancyLargeSpheres.Add(SphereIndex);
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; X++)
 	{
-		if (SectorSpacecrafts[i]->GetCompany() == Company)
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
 		{
-			CompanySpacecrafts.Add(SectorSpacecrafts[i]);
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+			{
+				OccupancyCells.Add(GetBroadPhaseCellKey(FIntVector(X, Y, Z)), SphereIndex);
+			}
 		}
 	}
-	return CompanySpacecrafts;
 }
 
-AFlareSpacecraft* UFlareSector::FindSpacecraft(FName Immatriculation)
+bool UFlareSector::IsOccupied(FVector Location, float Radius) const
 {
-	for (int i = 0 ; i < SectorSpacecrafts.Num(); i++)
+	for (int32 Index = 0; Index < OccupancyLargeSpheres.Num(); Index++)
+	{
+		const FSphere& Sphere = OccupancySpheres[OccupancyLargeSpheres[Index]];
+		if (FVector::Dist(Sphere.Center, Location) - Sphere.W <= Radius)
+		{
+			return true;
+		}
+	}
+
+	// Intersecting spheres share at least one cell
+	FIntVector MinCell = GetOccupancyCell(Location - FVector(Radius));
+	FIntVector MaxCell = GetOccupancyCell(Location + FVector(Radius));
+	TArray<int32, TInlineAllocator<16>> SphereIndices;
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+			{
+				SphereIndices.Reset();
+				OccupancyCells.MultiFind(GetBroadPhaseCellKey(FIntVector(X, Y, Z)), SphereIndices);
+
+				for (int32 Index = 0; Index < SphereIndices.Num(); Index++)
+				{
+					const FSphere& Sphere = OccupancySpheres[SphereIndices[Index]];
+					if (FVector::Dist(Sphere.Center, Location) - Sphere.W <= Radius)
+					{
+						return true;
+					}
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+FIntVector UFlareSector::GetOccupancyCell(FVector Location)
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / OCCUPANCY_CELL_SIZE),
+		FMath::FloorToInt(Location.Y / OCCUPANCY_CELL_SIZE),
+		FMath::FloorToInt(Location.Z / OCCUPANCY_CELL_SIZE));
+}
+
+void UFlareSector::GetNearSpacecrafts(FVector Location, float Radius, TArray<int32>& SpacecraftIndices)
+{
+	UpdateBroadPhase();
+	SpacecraftIndices.Reset();
+
+	float RadiusSquared = FMath::Square(Radius);
+	FIntVector MinCell = GetBroadPhaseCell(Location - FVector(Radius));
+	FIntVector MaxCell = GetBroadPhaseCell(Location + FVector(Radius));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; X++)
 	{
-		if (SectorSpacecrafts[i]->GetImmatriculation() == Immatriculation)
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
 		{
-			return SectorSpacecrafts[i];
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+			{
+				// Find the first entry of this cell
+				int64 Cell = GetBroadPhaseCellKey(FIntVector(X, Y, Z));
+				int32 Low = 0;
+				int32 High = BroadPhaseCells.Num();
+				while (Low < High)
+				{
+					int32 Middle = (Low + High) / 2;
+					if (BroadPhaseCells[Middle].Cell < Cell)
+					{
+						Low = Middle + 1;
+					}
+					else
+					{
+						High = Middle;
+					}
+				}
+
+				// Add all spacecrafts in range
+				for (int32 EntryIndex = Low; EntryIndex < BroadPhaseCells.Num() && BroadPhaseCells[EntryIndex].Cell == Cell; EntryIndex++)
+				{
+					int32 SpacecraftIndex = BroadPhaseCells[EntryIndex].SpacecraftIndex;
+					if ((BroadPhaseLocations[SpacecraftIndex] - Location).SizeSquared() <= RadiusSquared)
+					{
+						SpacecraftIndices.Add(SpacecraftIndex);
+					}
+				}
+			}
 		}
 	}
-	return NULL;
+
+	// Keep the sector order for deterministic results
+	SpacecraftIndices.Sort();
+}
+
+void UFlareSector::UpdateBroadPhase()
+{
+	if (BroadPhaseFrame == GFrameCounter && BroadPhaseLocations.Num() == SectorSpacecrafts.Num())
+	{
+		return;
+	}
+
+	BroadPhaseFrame = GFrameCounter;
+	BroadPhaseCells.Reset();
+	BroadPhaseLocations.Reset();
+	BroadPhaseSizes.Reset();
+
+	for (int32 SpacecraftIndex = 0; SpacecraftIndex < SectorSpacecrafts.Num(); SpacecraftIndex++)
+	{
+		AFlareSpacecraft* Spacecraft = SectorSpacecrafts[SpacecraftIndex];
+		FVector Location = Spacecraft->GetActorLocation();
+
+		FFlareSpacecraftCell Entry;
+		Entry.Cell = GetBroadPhaseCellKey(GetBroadPhaseCell(Location));
+		Entry.SpacecraftIndex = SpacecraftIndex;
+
+		BroadPhaseCells.Add(Entry);
+		BroadPhaseLocations.Add(Location);
+		BroadPhaseSizes.Add(Spacecraft->GetMeshScale());
+	}
+
+	BroadPhaseCells.Sort([](const FFlareSpacecraftCell& A, const FFlareSpacecraftCell& B)
+	{
+		return (A.Cell < B.Cell) || (A.Cell == B.Cell && A.SpacecraftIndex < B.SpacecraftIndex);
+	});
+}
+
+FIntVector UFlareSector::GetBroadPhaseCell(FVector Location)
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / BROAD_PHASE_CELL_SIZE),
+		FMath::FloorToInt(Location.Y / BROAD_PHASE_CELL_SIZE),
+		FMath::FloorToInt(Location.Z / BROAD_PHASE_CELL_SIZE));
+}
+
+int64 UFlareSector::GetBroadPhaseCellKey(FIntVector Cell)
+{
+	// 21 bits per axis, centered on the sector origin
+	const int64 Offset = 1 << 20;
+	const int64 Mask = (1 << 21) - 1;
+	return (((Cell.X + Offset) & Mask) << 42) | (((Cell.Y + Offset) & Mask) << 21) | ((Cell.Z + Offset) & Mask);
+}
+
+
+/*----------------------------------------------------
+	Anticollision
+----------------------------------------------------*/
+
+void UFlareSector::UpdateAnticollision()
+{
+	if (AnticollisionFrame == GFrameCounter
+	 && SpacecraftObstacles.Num() == SectorSpacecrafts.Num()
+	 && AsteroidObstacles.Num() == SectorAsteroids.Num())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_FlareSector_UpdateAnticollision);
+
+	AnticollisionFrame = GFrameCounter;
+	SpacecraftObstacles.Reset();
+	AsteroidObstacles.Reset();
+	SpacecraftObstacleIndices.Reset();
+	AnticollisionMaxSpeed = 0;
+	AnticollisionMaxSize = 0;
+
+	// Spacecraft bounds are computed once for all pilots
+	for (int32 SpacecraftIndex = 0; SpacecraftIndex < SectorSpacecrafts.Num(); SpacecraftIndex++)
+	{
+		AFlareSpacecraft* Spacecraft = SectorSpacecrafts[SpacecraftIndex];
+		FBox Box = Spacecraft->GetComponentsBoundingBox();
+
+		FFlareAnticollisionObstacle Obstacle;
+		Obstacle.Actor = Spacecraft;
+		Obstacle.Location = (Box.Max + Box.Min) / 2.0;
+		Obstacle.Velocity = Spacecraft->Airframe->GetPhysicsLinearVelocity();
+		Obstacle.Size = FMath::Max(Box.GetExtent().Size(), 1.0f);
+
+		SpacecraftObstacles.Add(Obstacle);
+		SpacecraftObstacleIndices.Add(Spacecraft, SpacecraftIndex);
+		AnticollisionMaxSpeed = FMath::Max(AnticollisionMaxSpeed, Obstacle.Velocity.Size());
+		AnticollisionMaxSize = FMath::Max(AnticollisionMaxSize, Obstacle.Size);
+	}
+
+	for (int32 AsteroidIndex = 0; AsteroidIndex < SectorAsteroids.Num(); AsteroidIndex++)
+	{
+		AFlareAsteroid* Asteroid = SectorAsteroids[AsteroidIndex];
+
+		FFlareAnticollisionObstacle Obstacle;
+		Obstacle.Actor = Asteroid;
+		Obstacle.Location = Asteroid->GetActorLocation();
+		Obstacle.Velocity = Asteroid->GetAsteroidComponent()->GetPhysicsLinearVelocity();
+		Obstacle.Size = Asteroid->GetAsteroidComponent()->Bounds.SphereRadius;
+
+		AsteroidObstacles.Add(Obstacle);
+		AnticollisionMaxSpeed = FMath::Max(AnticollisionMaxSpeed, Obstacle.Velocity.Size());
+		AnticollisionMaxSize = FMath::Max(AnticollisionMaxSize, Obstacle.Size);
+	}
+
+	for (int32 ColliderIndex = 0; ColliderIndex < ColliderObstacles.Num(); ColliderIndex++)
+	{
+		AnticollisionMaxSize = FMath::Max(AnticollisionMaxSize, ColliderObstacles[ColliderIndex].Size);
+	}
+}
+
+void UFlareSector::GetAnticollisionObstacles(AFlareSpacecraft* Spacecraft, TArray<const FFlareAnticollisionObstacle*>& Obstacles)
+{
+	Obstacles.Reset();
+
+	const FFlareAnticollisionObstacle* SpacecraftObstacle = GetSpacecraftObstacle(Spacecraft);
+	if (!SpacecraftObstacle)
+	{
+		return;
+	}
+
+	// An obstacle further than this can't be hit within the anticollision horizon
+	float SizeSum = SpacecraftObstacle->Size + AnticollisionMaxSize;
+	float Radius = (SpacecraftObstacle->Velocity.Size() + AnticollisionMaxSpeed) * ANTICOLLISION_HORIZON + 2 * SizeSum;
+	float RadiusSquared = FMath::Square(Radius);
+
+	// Spacecrafts come from the broad phase, that uses actor locations instead of bound centers
+	GetNearSpacecrafts(Spacecraft->GetActorLocation(), Radius + SizeSum, AnticollisionSpacecraftIndices);
+	for (int32 Index = 0; Index < AnticollisionSpacecraftIndices.Num(); Index++)
+	{
+		const FFlareAnticollisionObstacle& Obstacle = SpacecraftObstacles[AnticollisionSpacecraftIndices[Index]];
+		if (Obstacle.Actor == SectorSpacecrafts[AnticollisionSpacecraftIndices[Index]]
+		 && (Obstacle.Location - SpacecraftObstacle->Location).SizeSquared() <= RadiusSquared)
+		{
+			Obstacles.Add(&Obstacle);
+		}
+	}
+
+	for (int32 AsteroidIndex = 0; AsteroidIndex < AsteroidObstacles.Num(); AsteroidIndex++)
+	{
+		if ((AsteroidObstacles[AsteroidIndex].Location - SpacecraftObstacle->Location).SizeSquared() <= RadiusSquared)
+		{
+			Obstacles.Add(&AsteroidObstacles[AsteroidIndex]);
+		}
+	}
+
+	for (int32 ColliderIndex = 0; ColliderIndex < ColliderObstacles.Num(); ColliderIndex++)
+	{
+		if ((ColliderObstacles[ColliderIndex].Location - SpacecraftObstacle->Location).SizeSquared() <= RadiusSquared)
+		{
+			Obstacles.Add(&ColliderObstacles[ColliderIndex]);
+		}
+	}
+}
+
+const FFlareAnticollisionObstacle* UFlareSector::GetSpacecraftObstacle(AFlareSpacecraft* Spacecraft)
+{
+	UpdateAnticollision();
+
+	int32* Index = SpacecraftObstacleIndices.Find(Spacecraft);
+	return (Index ? &SpacecraftObstacles[*Index] : NULL);
+}
+
+
+/*----------------------------------------------------
+	AI level of detail
+----------------------------------------------------*/
+
+int32 UFlareSector::GetAILevelOfDetail(AFlareSpacecraft* Spacecraft) const
+{
+	AFlareSpacecraft* PlayerShip = ParentSector->GetGame()->GetPC()->GetShipPawn();
+
+	// Player ship, ships in combat and ships under fire always update at full rate
+	if (Spacecraft == PlayerShip || !PlayerShip || Spacecraft->GetPilot()->GetTargetShip()
+	 || Spacecraft->GetDamageSystem()->GetTimeSinceLastExternalDamage() < AI_LOD_DAMAGE_DELAY)
+	{
+		return 0;
+	}
+
+	// Docked ships are idle
+	if (Spacecraft->GetNavigationSystem()->IsDocked())
+	{
+		return 3;
+	}
+
+	// Fade with distance to the player
+	float PlayerDistance = (Spacecraft->GetActorLocation() - PlayerShip->GetActorLocation()).Size();
+	if (PlayerDistance < AI_LOD_NEAR_DISTANCE)
+	{
+		return 0;
+	}
+	else if (PlayerDistance < AI_LOD_FAR_DISTANCE)
+	{
+		return 1;
+	}
+	else
+	{
+		return 2;
+	}
+}
+
+void UFlareSector::UpdateAIUpdateBudget()
+{
+	UFlareGameUserSettings* MyGameSettings = Cast<UFlareGameUserSettings>(GEngine->GetGameUserSettings());
+	AIUpdateBudget = MyGameSettings->AIUpdateBudget;
+}
+
+bool UFlareSector::ScheduleAIUpdate(AFlareSpacecraft* Spacecraft)
+{
+	// New frame, reset the budget
+	if (AIUpdateFrame != GFrameCounter)
+	{
+		AIUpdateFrame = GFrameCounter;
+		AIUpdateCount = 0;
+		SET_DWORD_STAT(STAT_FlareSector_AIUpdateBudget, AIUpdateBudget);
+	}
+
+	// Full rate
+	int32 LevelOfDetail = Spacecraft->GetAILevelOfDetail();
+	if (LevelOfDetail == 0 || AIUpdateBudget <= 0)
+	{
+		INC_DWORD_STAT(STAT_FlareSector_AIUpdates);
+		return true;
+	}
+
+	// Update every 2^LOD frames, staggered by the last update frame of each ship
+	int32 UpdateInterval = 1 << LevelOfDetail;
+	if (Spacecraft->GetAIFramesSinceUpdate() < UpdateInterval)
+	{
+		return false;
+	}
+
+	// Defer when over budget, unless the ship has waited too long already
+	if (AIUpdateCount >= AIUpdateBudget && Spacecraft->GetAIFramesSinceUpdate() < UpdateInterval * 4)
+	{
+		INC_DWORD_STAT(STAT_FlareSector_AIDeferredUpdates);
+		return false;
+	}
+
+	AIUpdateCount++;
+	INC_DWORD_STAT(STAT_FlareSector_AIUpdates);
+	return true;
+}
+
+
+/*----------------------------------------------------
+	Getters
+----------------------------------------------------*/
+
+const TArray<AFlareSpacecraft*>& UFlareSector::GetCompanyShips(UFlareCompany* Company) const
+{
+	static const TArray<AFlareSpacecraft*> NoSpacecrafts;
+
+	const TArray<AFlareSpacecraft*>* CompanyShips = CompanyShipIndex.Find(Company);
+	return CompanyShips ? *CompanyShips : NoSpacecrafts;
+}
+
+const TArray<AFlareSpacecraft*>& UFlareSector::GetCompanySpacecrafts(UFlareCompany* Company) const
+{
+	static const TArray<AFlareSpacecraft*> NoSpacecrafts;
+
+	const TArray<AFlareSpacecraft*>* CompanySpacecrafts = CompanySpacecraftIndex.Find(Company);
+	return CompanySpacecrafts ? *CompanySpacecrafts : NoSpacecrafts;
+}
+
+AFlareSpacecraft* UFlareSector::FindSpacecraft(FName Immatriculation)
+{
+	AFlareSpacecraft** Spacecraft = SpacecraftImmatriculationIndex.Find(Immatriculation);
+	return Spacecraft ? *Spacecraft : NULL;
 }
 
 
@@ -570,15 +1256,14 @@ void UFlareSector::GenerateSectorRepartitionCache()
 		FVector SectorMin = FVector(INFINITY, INFINITY, INFINITY);
 		FVector SectorMax = FVector(-INFINITY, -INFINITY, -INFINITY);
 
-		for (int SpacecraftIndex = 0 ; SpacecraftIndex < SectorSpacecrafts.Num(); SpacecraftIndex++)
+		// Use the simulated stations, as they may not be all spawned yet
+		for (int StationIndex = 0 ; StationIndex < ParentSector->GetSectorStations().Num(); StationIndex++)
 		{
-			AFlareSpacecraft *Spacecraft = SectorSpacecrafts[SpacecraftIndex];
-			if (Spacecraft->IsStation())
-			{
-				SectorMin = SectorMin.ComponentMin(Spacecraft->GetActorLocation());
-				SectorMax = SectorMax.ComponentMax(Spacecraft->GetActorLocation());
-				SignificantObjectCount++;
-			}
+			UFlareSimulatedSpacecraft *Station = ParentSector->GetSectorStations()[StationIndex];
+			FVector StationLocation = (Station->IsActive() ? Station->GetActive()->GetActorLocation() : Station->GetData().Location);
+			SectorMin = SectorMin.ComponentMin(StationLocation);
+			SectorMax = SectorMax.ComponentMax(StationLocation);
+			SignificantObjectCount++;
 		}
 
 		if (SignificantObjectCount > 0)
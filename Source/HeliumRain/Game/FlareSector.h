@@ -10,6 +10,33 @@
 class UFlareSimulatedSector;
 class AFlareGame;
 class AFlareAsteroid;
+class AFlareCollider;
+
+
+/** Spacecraft entry in the broad phase grid */
+struct FFlareSpacecraftCell
+{
+	int64                          Cell;
+	int32                          SpacecraftIndex;
+};
+
+/** Bounds of an asteroid or collider, registered once when the body is loaded */
+struct FFlareBodyBounds
+{
+	AActor*                        Actor;
+	FVector                        Location;
+	float                          Size;
+	bool                           Movable;
+};
+
+/** Obstacle data used by anticollision, cached once per frame */
+struct FFlareAnticollisionObstacle
+{
+	AActor*                        Actor;
+	FVector                        Location;
+	FVector                        Velocity;
+	float                          Size;
+};
 
 UCLASS()
 class HELIUMRAIN_API UFlareSector : public UObject
@@ -31,6 +58,15 @@ public:
 	/** Destroy the sector */
 	virtual void DestroySector();
 
+	/** Spawn part of the remaining spacecrafts within the frame budget, and finish the activation when all are spawned */
+	void UpdateActivation();
+
+	/** Is the sector still spawning spacecrafts */
+	inline bool IsActivating() const
+	{
+		return !ActivationComplete;
+	}
+
 
 	/*----------------------------------------------------
 		Gameplay
@@ -54,10 +90,99 @@ public:
 
 	AActor* GetNearestBody(FVector Location, float* NearestDistance, bool IncludeSize = true, AActor* ActorToIgnore = NULL);
 
+	/** Get the bounds of all colliders and asteroids, with asteroid locations updated for this frame */
+	const TArray<FFlareBodyBounds>& GetBodyBounds();
+
 	void PlaceSpacecraft(AFlareSpacecraft* Spacecraft, FVector Location);
 
+	/** Get the indices of spacecrafts whose location is within Radius of Location, in spacecraft order */
+	void GetNearSpacecrafts(FVector Location, float Radius, TArray<int32>& SpacecraftIndices);
+
+	/** Location of a spacecraft, as cached in the broad phase of this frame */
+	inline FVector GetBroadPhaseLocation(int32 SpacecraftIndex) const
+	{
+		return BroadPhaseLocations[SpacecraftIndex];
+	}
+
+	/** Size of a spacecraft, as cached in the broad phase of this frame */
+	inline float GetBroadPhaseSize(int32 SpacecraftIndex) const
+	{
+		return BroadPhaseSizes[SpacecraftIndex];
+	}
+
+
+	/*----------------------------------------------------
+		Anticollision
+	----------------------------------------------------*/
+
+	/** Build the anticollision obstacles if not done yet this frame */
+	void UpdateAnticollision();
+
+	/** Get the obstacles that may come within 5 seconds of a spacecraft, in spacecraft, asteroid, collider order */
+	void GetAnticollisionObstacles(AFlareSpacecraft* Spacecraft, TArray<const FFlareAnticollisionObstacle*>& Obstacles);
+
+	/** Get the obstacle data of a spacecraft for this frame */
+	const FFlareAnticollisionObstacle* GetSpacecraftObstacle(AFlareSpacecraft* Spacecraft);
+
+
+	/*----------------------------------------------------
+		AI level of detail
+	----------------------------------------------------*/
+
+	/** Get the AI level of detail for a spacecraft : 0 is full rate, higher levels update less often */
+	int32 GetAILevelOfDetail(AFlareSpacecraft* Spacecraft) const;
+
+	/** Decide if the AI of a spacecraft should update this frame, within the frame budget */
+	bool ScheduleAIUpdate(AFlareSpacecraft* Spacecraft);
+
+	/** Read the AI update budget from the settings */
+	void UpdateAIUpdateBudget();
+
 protected:
 
+	/** Start loading the templates and meshes of all queued spacecrafts */
+	void PreloadActivationAssets();
+
+	/** Get the templates and meshes needed to spawn a spacecraft */
+	void GetSpacecraftAssets(UFlareSimulatedSpacecraft* ParentSpacecraft, TArray<FStringAssetReference>& Assets);
+
+	/** Check if a queued spacecraft can be spawned without waiting on a load */
+	bool AreSpacecraftAssetsLoaded(UFlareSimulatedSpacecraft* ParentSpacecraft);
+
+	/** Spawn a spacecraft during activation and restore its docking state */
+	void ActivateSpacecraft(UFlareSimulatedSpacecraft* ParentSpacecraft);
+
+	/** Finish the activation once all spacecrafts are spawned, and notify the player and quests */
+	void FinishActivation();
+
+	/** Add an asteroid or collider to the body bounds */
+	void RegisterBody(AActor* Body, float Size, bool Movable);
+
+	/** Clear the placement occupancy, and fill it with asteroids and colliders */
+	void ResetOccupancy();
+
+	/** Reset the placement occupancy, and add the current bounds of all spacecrafts but one */
+	void FillOccupancy(AFlareSpacecraft* IgnoredSpacecraft);
+
+	/** Mark a sphere as occupied for spacecraft placement */
+	void AddOccupancy(FVector Location, float Radius);
+
+	/** Check if a sphere intersects an occupied one */
+	bool IsOccupied(FVector Location, float Radius) const;
+
+	/** Get the placement occupancy cell containing a location */
+	static FIntVector GetOccupancyCell(FVector Location);
+
+	/** Build the spacecraft broad phase grid if not done yet this frame */
+	void UpdateBroadPhase();
+
+	/** Get the broad phase cell containing a location */
+	static FIntVector GetBroadPhaseCell(FVector Location);
+
+	/** Get the sortable key of a broad phase cell */
+	static int64 GetBroadPhaseCellKey(FIntVector Cell);
+
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -72,6 +197,11 @@ protected:
 
 	UPROPERTY()
 	TArray<AFlareSpacecraft*>      SectorSpacecrafts;
+
+	// Lookup indexes over the spacecraft arrays above
+	TMap<UFlareCompany*, TArray<AFlareSpacecraft*>> CompanyShipIndex;
+	TMap<UFlareCompany*, TArray<AFlareSpacecraft*>> CompanySpacecraftIndex;
+	TMap<FName, AFlareSpacecraft*> SpacecraftImmatriculationIndex;
 	
 	UPROPERTY()
 	TArray<AFlareAsteroid*>        SectorAsteroids;
@@ -79,6 +209,8 @@ protected:
 	TArray<AFlareBomb*>            SectorBombs;
 	UPROPERTY()
 	TArray<AFlareShell*>           SectorShells;
+	UPROPERTY()
+	TArray<AFlareCollider*>        SectorColliders;
 
 	int64						   LocalTime;
 	bool						   SectorRepartitionCache;
@@ -86,6 +218,46 @@ protected:
 	FVector                        SectorCenter;
 	float                          SectorRadius;
 
+	// Time-sliced activation
+	TArray<UFlareSimulatedSpacecraft*> ActivationQueue;
+	int32                          ActivationIndex;
+	int32                          ActivationSafeCount;
+	bool                           ActivationComplete;
+	bool                           ActivationPlayerShipFlown;
+	double                         ActivationStartTime;
+	double                         ActivationFirstFrameDuration;
+	int32                          ActivationFrameCount;
+
+	// Asteroid and collider bounds
+	TArray<FFlareBodyBounds>       BodyBounds;
+	uint64                         BodyBoundsFrame;
+
+	// Spacecraft placement occupancy, valid during activation
+	TArray<FSphere>                OccupancySpheres;
+	TMultiMap<int64, int32>        OccupancyCells;
+	TArray<int32>                  OccupancyLargeSpheres;
+
+	// AI level of detail budget
+	uint64                         AIUpdateFrame;
+	int32                          AIUpdateCount;
+	int32                          AIUpdateBudget;
+
+	// Spacecraft broad phase, built once per frame
+	uint64                         BroadPhaseFrame;
+	TArray<FFlareSpacecraftCell>   BroadPhaseCells;
+	TArray<FVector>                BroadPhaseLocations;
+	TArray<float>                  BroadPhaseSizes;
+
+	// Anticollision obstacles, built once per frame
+	uint64                         AnticollisionFrame;
+	TArray<FFlareAnticollisionObstacle> SpacecraftObstacles;
+	TArray<FFlareAnticollisionObstacle> AsteroidObstacles;
+	TArray<FFlareAnticollisionObstacle> ColliderObstacles;
+	TMap<AFlareSpacecraft*, int32> SpacecraftObstacleIndices;
+	float                          AnticollisionMaxSpeed;
+	float                          AnticollisionMaxSize;
+	TArray<int32>                  AnticollisionSpacecraftIndices;
+
 
 public:
 
@@ -103,9 +275,11 @@ public:
 		return ParentSector;
 	}
 
-	TArray<AFlareSpacecraft*> GetCompanyShips(UFlareCompany* Company);
+	/** Get the ships of a company in this sector, the returned array is only valid until the next spacecraft load */
+	const TArray<AFlareSpacecraft*>& GetCompanyShips(UFlareCompany* Company) const;
 
-	TArray<AFlareSpacecraft*> GetCompanySpacecrafts(UFlareCompany* Company);
+	/** Get the spacecrafts of a company in this sector, the returned array is only valid until the next spacecraft load */
+	const TArray<AFlareSpacecraft*>& GetCompanySpacecrafts(UFlareCompany* Company) const;
 
 	AFlareSpacecraft* FindSpacecraft(FName Immatriculation);
 
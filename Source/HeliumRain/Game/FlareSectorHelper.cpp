@@ -169,7 +169,7 @@ int32 SectorHelper::Trade(UFlareSimulatedSpacecraft*  SourceSpacecraft, UFlareSi
 {
 	if(!SourceSpacecraft->CanTradeWith(DestinationSpacecraft))
 	{
-		FLOG("Both spacecraft cannot trade");
+		FLOGC(LogFlareEconomy, "Both spacecraft cannot trade");
 		return 0;
 	}
 
@@ -257,7 +257,7 @@ void SectorHelper::GetAvailableFleetSupplyCount(UFlareSimulatedSector* Sector, U
 	int32 MaxAffordableQuantity = Company->GetMoney() / ResourcePrice;
 
 	AffordableFS = OwnedFS + FMath::Min(MaxAffordableQuantity, NotOwnedFS);
-	/*FLOGV("GetAvailableFleetSupplyCount for %s in %s: AvailableFS=%d AffordableFS=%d",
+	/*FLOGCV(LogFlareEconomy, "GetAvailableFleetSupplyCount for %s in %s: AvailableFS=%d AffordableFS=%d",
 		  *Company->GetCompanyName().ToString(),
 		  *Sector->GetSectorName().ToString(),
 		  AvailableFS,
@@ -323,7 +323,7 @@ void SectorHelper::GetRepairFleetSupplyNeeds(UFlareSimulatedSector* Sector, UFla
 	CurrentNeededFleetSupply = FMath::CeilToInt(PreciseCurrentNeededFleetSupply);
 	TotalNeededFleetSupply = FMath::CeilToInt(PreciseTotalNeededFleetSupply);
 
-	/*FLOGV("GetRepairFleetSupplyNeeds for %s in %s: CurrentNeededFleetSupply=%f %d TotalNeededFleetSupply=%f %d",
+	/*FLOGCV(LogFlareEconomy, "GetRepairFleetSupplyNeeds for %s in %s: CurrentNeededFleetSupply=%f %d TotalNeededFleetSupply=%f %d",
 		  *Company->GetCompanyName().ToString(),
 		  *Sector->GetSectorName().ToString(),
 		  PreciseCurrentNeededFleetSupply,
@@ -433,7 +433,7 @@ void SectorHelper::RepairFleets(UFlareSimulatedSector* Sector, UFlareCompany* Co
 
 	int32 ConsumedFS = FMath::CeilToInt((float) AffordableFS - RemainingFS);
 
-	FLOGV("Repair consumed %d FS", ConsumedFS);
+	FLOGCV(LogFlareEconomy, "Repair consumed %d FS", ConsumedFS);
 	ConsumeFleetSupply(Sector, Company, ConsumedFS);
 }
 
@@ -491,7 +491,7 @@ void SectorHelper::RefillFleets(UFlareSimulatedSector* Sector, UFlareCompany* Co
 
 	int32 ConsumedFS = FMath::CeilToInt((float) AffordableFS - RemainingFS);
 
-	FLOGV("Refill consumed %d FS", ConsumedFS);
+	FLOGCV(LogFlareEconomy, "Refill consumed %d FS", ConsumedFS);
 	ConsumeFleetSupply(Sector, Company, ConsumedFS);
 }
 
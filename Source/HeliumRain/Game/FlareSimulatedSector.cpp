@@ -7,6 +7,7 @@
 #include "FlareGameUserSettings.h"
 #include "../Economy/FlareCargoBay.h"
 #include "../Spacecrafts/FlareSimulatedSpacecraft.h"
+#include "Save/FlareSaveCache.h"
 #include "../Player/FlarePlayerController.h"
 
 DECLARE_CYCLE_STAT(TEXT("FlareSector SimulatePriceVariation"), STAT_FlareSector_SimulatePriceVariation, STATGROUP_Flare);
@@ -24,6 +25,7 @@ UFlareSimulatedSector::UFlareSimulatedSector(const FObjectInitializer& ObjectIni
 	: Super(ObjectInitializer)
 {
 	PersistentStationIndex = 0;
+	SaveRevision = 0;
 }
 
 void UFlareSimulatedSector::Load(const FFlareSectorDescription* Description, const FFlareSectorSave& Data, const FFlareSectorOrbitParameters& OrbitParameters)
@@ -98,6 +100,7 @@ void UFlareSimulatedSector::Load(const FFlareSectorDescription* Description, con
 	}
 
 	LoadResourcePrices();
+	SetDirty();
 }
 
 UFlarePeople* UFlareSimulatedSector::LoadPeople(const FFlarePeopleSave& PeopleData)
@@ -111,31 +114,52 @@ UFlarePeople* UFlareSimulatedSector::LoadPeople(const FFlarePeopleSave& PeopleDa
 
 FFlareSectorSave* UFlareSimulatedSector::Save()
 {
-	SectorData.SpacecraftIdentifiers.Empty();
-	SectorData.FleetIdentifiers.Empty();
+	// Contents, people and prices are owned by other objects, compare them with the previous save
+	TArray<FName> SpacecraftIdentifiers;
+	TArray<FName> FleetIdentifiers;
+	TArray<FFFlareResourcePrice> Prices;
 
 	for (int i = 0 ; i < SectorSpacecrafts.Num(); i++)
 	{
-		SectorData.SpacecraftIdentifiers.Add(SectorSpacecrafts[i]->GetImmatriculation());
+		SpacecraftIdentifiers.Add(SectorSpacecrafts[i]->GetImmatriculation());
 	}
 
 	for (int i = 0 ; i < SectorFleets.Num(); i++)
 	{
-		SectorData.FleetIdentifiers.Add(SectorFleets[i]->GetIdentifier());
+		FleetIdentifiers.Add(SectorFleets[i]->GetIdentifier());
 	}
 
-	SectorData.PeopleData = *People->Save();
+	FFlarePeopleSave* PeopleData = People->Save();
 
-	SaveResourcePrices();
+	SaveResourcePrices(Prices);
 
+	if (SpacecraftIdentifiers != SectorData.SpacecraftIdentifiers
+	 || FleetIdentifiers != SectorData.FleetIdentifiers
+	 || !FFlareSaveCache::IsSameData(*PeopleData, SectorData.PeopleData)
+	 || !FFlareSaveCache::IsSameData(Prices, SectorData.ResourcePrices))
+	{
+		SectorData.SpacecraftIdentifiers = SpacecraftIdentifiers;
+		SectorData.FleetIdentifiers = FleetIdentifiers;
+		SectorData.PeopleData = *PeopleData;
+		SectorData.ResourcePrices = Prices;
+		SetDirty();
+	}
+
+	// The active sector saves its asteroids, bombs and time
 	if(Game->GetActiveSector() && Game->GetActiveSector()->GetSimulatedSector() == this)
 	{
 		Game->GetActiveSector()->Save();
+		SetDirty();
 	}
 
 	return &SectorData;
 }
 
+void UFlareSimulatedSector::SetDirty()
+{
+	SaveRevision = FFlareSaveCache::NewRevision();
+}
+
 
 UFlareSimulatedSpacecraft* UFlareSimulatedSector::CreateStation(FName StationClass, UFlareCompany* Company, FFlareStationSpawnParameters SpawnParameters)
 {
@@ -398,6 +422,7 @@ void UFlareSimulatedSector::CreateAsteroid(int32 ID, FName Name, FVector Locatio
 	Data.Location = Location;
 
 	SectorData.AsteroidData.Add(Data);
+	SetDirty();
 }
 
 void UFlareSimulatedSector::AddFleet(UFlareFleet* Fleet)
@@ -852,6 +877,7 @@ void UFlareSimulatedSector::AttachStationToAsteroid(UFlareSimulatedSpacecraft* S
 		FLOGV("UFlareSimulatedSector::AttachStationToAsteroid : Found asteroid we need to attach to ('%s')", *AsteroidSave->Identifier.ToString());
 		Spacecraft->SetAsteroidData(AsteroidSave);
 		SectorData.AsteroidData.RemoveAt(AsteroidSaveIndex);
+		SetDirty();
 	}
 	else
 	{
@@ -1065,6 +1091,7 @@ void UFlareSimulatedSector::ClearBombs()
 	}
 
 	SectorData.BombData.Empty();
+	SetDirty();
 }
 
 void UFlareSimulatedSector::GetSectorBalance(int32& PlayerShips, int32& EnemyShips, int32& NeutralShips, bool ActiveOnly)
@@ -1160,14 +1187,17 @@ void UFlareSimulatedSector::LoadResourcePrices()
 		float Price = ResourcePrice->Price;
 		ResourcePrices.Add(Resource, Price);
 		FFlareFloatBuffer* Prices = &ResourcePrice->Prices;
-		Prices->Resize(50);
+		if (Prices->MaxSize != SECTOR_PRICE_HISTORY_SIZE)
+		{
+			Prices->Resize(SECTOR_PRICE_HISTORY_SIZE);
+		}
 		LastResourcePrices.Add(Resource, *Prices);
 	}
 }
 
-void UFlareSimulatedSector::SaveResourcePrices()
+void UFlareSimulatedSector::SaveResourcePrices(TArray<FFFlareResourcePrice>& Prices)
 {
-	SectorData.ResourcePrices.Empty();
+	Prices.Empty();
 
 	for(int32 ResourceIndex = 0; ResourceIndex < Game->GetResourceCatalog()->Resources.Num(); ResourceIndex++)
 	{
@@ -1180,7 +1210,7 @@ void UFlareSimulatedSector::SaveResourcePrices()
 			if (LastResourcePrices.Contains(Resource))
 			{
 				Price.Prices = LastResourcePrices[Resource];
-				SectorData.ResourcePrices.Add(Price);
+				Prices.Add(Price);
 			}
 		}
 	}
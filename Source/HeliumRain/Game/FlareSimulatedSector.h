@@ -9,6 +9,8 @@
 #include "../Player/FlareSoundManager.h"
 #include "FlareSimulatedSector.generated.h"
 
+#define SECTOR_PRICE_HISTORY_SIZE 50
+
 class UFlareSimulatedSpacecraft;
 struct FFlareSpacecraftDescription;
 class UFlareFleet;
@@ -358,9 +360,12 @@ public:
 	/** Save the sector to a save file */
     virtual FFlareSectorSave* Save();
 
+	/** Signal that the sector save data changed since the last save */
+	void SetDirty();
+
 	void LoadResourcePrices();
 
-	void SaveResourcePrices();
+	void SaveResourcePrices(TArray<FFFlareResourcePrice>& Prices);
 
 
     /*----------------------------------------------------
@@ -428,6 +433,7 @@ protected:
 
     // Gameplay data
 	FFlareSectorSave                        SectorData;
+	uint64                                  SaveRevision;
     TArray<UFlareSimulatedSpacecraft*>      SectorStations;
 	TArray<UFlareSimulatedSpacecraft*>      SectorShips;
 	TArray<UFlareSimulatedSpacecraft*>      SectorSpacecrafts;
@@ -464,6 +470,12 @@ public:
 		return &SectorData;
 	}
 
+	/** Revision of the sector save data, changed each time the data is modified */
+	inline uint64 GetSaveRevision() const
+	{
+		return SaveRevision;
+	}
+
 	/** Get the name of this sector */
 	FText GetSectorName();
 
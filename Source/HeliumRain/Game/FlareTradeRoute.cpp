@@ -41,7 +41,7 @@ FFlareTradeRouteSave* UFlareTradeRoute::Save()
 
 void UFlareTradeRoute::Simulate()
 {
-	FLOG("Trade route simulate");
+	FLOGC(LogFlareEconomy, "Trade route simulate");
 
 	if(TradeRouteData.IsPaused)
 	{
@@ -51,14 +51,14 @@ void UFlareTradeRoute::Simulate()
 
 	if (TradeRouteData.Sectors.Num() == 0 || TradeRouteFleet == NULL)
     {
-		FLOG("  -> no sector or assigned fleet");
+		FLOGC(LogFlareEconomy, "  -> no sector or assigned fleet");
         // Nothing to do
         return;
     }
 
 	if (TradeRouteFleet->IsTraveling())
 	{
-		FLOG("  -> is travelling");
+		FLOGC(LogFlareEconomy, "  -> is travelling");
 		return;
 	}
 
@@ -100,7 +100,7 @@ void UFlareTradeRoute::Simulate()
 
 	if (TargetSector && TargetSector != CurrentSector)
 	{
-		FLOGV("  -> start travel to %s", *TargetSector->GetSectorName().ToString());
+		FLOGCV(LogFlareEconomy, "  -> start travel to %s", *TargetSector->GetSectorName().ToString());
 		// Travel to next sector
 		Game->GetGameWorld()->StartTravel(TradeRouteFleet, TargetSector);
 	}
@@ -114,11 +114,11 @@ UFlareSimulatedSector* UFlareTradeRoute::UpdateTargetSector()
 		TargetSector = GetNextTradeSector(NULL);
 		if(TargetSector)
 		{
-			FLOGV("Has TargetSector %s", *TargetSector->GetIdentifier().ToString());
+			FLOGCV(LogFlareEconomy, "Has TargetSector %s", *TargetSector->GetIdentifier().ToString());
 		}
 		else
 		{
-			FLOG("Has no TargetSector");
+			FLOGC(LogFlareEconomy, "Has no TargetSector");
 		}
 		SetTargetSector(TargetSector);
 	}
@@ -136,7 +136,7 @@ bool UFlareTradeRoute::ProcessCurrentOperation(FFlareTradeRouteSectorOperationSa
 
 	if (Operation->MaxWait != -1 && TradeRouteData.CurrentOperationDuration >= Operation->MaxWait)
 	{
-		FLOGV("Max wait duration reach (%d)", Operation->MaxWait);
+		FLOGCV(LogFlareEconomy, "Max wait duration reach (%d)", Operation->MaxWait);
 		return true;
 	}
 
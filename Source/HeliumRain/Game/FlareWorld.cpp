@@ -7,9 +7,12 @@
 #include "FlareTravel.h"
 #include "FlareFleet.h"
 #include "FlareBattle.h"
+#include "FlareSaveGame.h"
+#include "Async/ParallelFor.h"
 
 #include "../Data/FlareSectorCatalogEntry.h"
 #include "../Player/FlarePlayerController.h"
+#include "../Quests/FlareQuestManager.h"
 
 #define LOCTEXT_NAMESPACE "FlareWorld"
 
@@ -22,6 +25,8 @@
 UFlareWorld::UFlareWorld(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
+	HostilityVersion = 0;
+	EconomyVersion = 0;
 }
 
 void UFlareWorld::Load(const FFlareWorldSave& Data)
@@ -40,28 +45,34 @@ void UFlareWorld::Load(const FFlareWorldSave& Data)
 		LoadCompany(WorldData.CompanyData[i]);
     }
 
-	// Load sectors
+	// Find the save of each sector, keeping the first one if there are duplicates
 	TArray<UFlareSectorCatalogEntry*> SectorList = Game->GetSectorCatalog();
-	for (int32 SectorIndex = 0; SectorIndex < SectorList.Num(); SectorIndex++)
+	TMap<FName, FFlareSectorSave*> SectorSavesByIdentifier;
+	for (int32 i = 0; i < WorldData.SectorData.Num(); i++)
 	{
-		const FFlareSectorDescription* SectorDescription = &SectorList[SectorIndex]->Data;
-
-		// Find save if exist
-		FFlareSectorSave* SectorSave = NULL;
-		for (int32 i = 0; i < WorldData.SectorData.Num(); i++)
+		if (!SectorSavesByIdentifier.Contains(WorldData.SectorData[i].Identifier))
 		{
-			if (WorldData.SectorData[i].Identifier == SectorDescription->Identifier)
-			{
-				// Old save found
-				SectorSave = &WorldData.SectorData[i];
-				break;
-			}
+			SectorSavesByIdentifier.Add(WorldData.SectorData[i].Identifier, &WorldData.SectorData[i]);
 		}
+	}
+
+	// Prepare the sector data on all cores, it doesn't involve any object
+	TArray<FFlareSectorSave*> SectorSaves;
+	TArray<FFlareSectorSave> NewSectorSaves;
+	TArray<FFlareSectorOrbitParameters> SectorOrbitParameters;
+	SectorSaves.SetNum(SectorList.Num());
+	NewSectorSaves.SetNum(SectorList.Num());
+	SectorOrbitParameters.SetNum(SectorList.Num());
+
+	ParallelFor(SectorList.Num(), [&](int32 SectorIndex)
+	{
+		const FFlareSectorDescription* SectorDescription = &SectorList[SectorIndex]->Data;
+		FFlareSectorSave* SectorSave = SectorSavesByIdentifier.FindRef(SectorDescription->Identifier);
 
-		FFlareSectorSave NewSectorData;
 		if (!SectorSave)
 		{
 			// No save, init new sector
+			FFlareSectorSave& NewSectorData = NewSectorSaves[SectorIndex];
 			NewSectorData.GivenName = FText();
 			NewSectorData.Identifier = SectorDescription->Identifier;
 			NewSectorData.LocalTime = 0;
@@ -88,12 +99,28 @@ void UFlareWorld::Load(const FFlareWorldSave& Data)
 			SectorSave = &NewSectorData;
 		}
 
-		FFlareSectorOrbitParameters OrbitParameters;
+		// Bring price histories to their current size
+		for (int32 PriceIndex = 0; PriceIndex < SectorSave->ResourcePrices.Num(); PriceIndex++)
+		{
+			FFlareFloatBuffer& Prices = SectorSave->ResourcePrices[PriceIndex].Prices;
+			if (Prices.MaxSize != SECTOR_PRICE_HISTORY_SIZE)
+			{
+				Prices.Resize(SECTOR_PRICE_HISTORY_SIZE);
+			}
+		}
+
+		FFlareSectorOrbitParameters& OrbitParameters = SectorOrbitParameters[SectorIndex];
 		OrbitParameters.CelestialBodyIdentifier = SectorDescription->CelestialBodyIdentifier;
 		OrbitParameters.Altitude = SectorDescription->Altitude;
 		OrbitParameters.Phase = SectorDescription->Phase;
 
-		LoadSector(SectorDescription, *SectorSave, OrbitParameters);
+		SectorSaves[SectorIndex] = SectorSave;
+	});
+
+	// Create the sectors in catalog order
+	for (int32 SectorIndex = 0; SectorIndex < SectorList.Num(); SectorIndex++)
+	{
+		LoadSector(&SectorList[SectorIndex]->Data, *SectorSaves[SectorIndex], SectorOrbitParameters[SectorIndex]);
 	}
 
 	// Load all travels
@@ -164,42 +191,73 @@ UFlareTravel* UFlareWorld::LoadTravel(const FFlareTravelSave& TravelData)
 }
 
 
-FFlareWorldSave* UFlareWorld::Save()
+void UFlareWorld::Save(FFlareWorldSave& Snapshot)
 {
+	// Objects are only kept in the world data until they are loaded
 	WorldData.CompanyData.Empty();
 	WorldData.SectorData.Empty();
 	WorldData.TravelData.Empty();
 
+	Snapshot.Date = WorldData.Date;
+	Snapshot.FleetSupplyConsumptionStats = WorldData.FleetSupplyConsumptionStats;
+	Snapshot.DailyFleetSupplyConsumption = WorldData.DailyFleetSupplyConsumption;
+
 	// Companies
+	Snapshot.CompanyData.Empty(Companies.Num());
 	for (int i = 0; i < Companies.Num(); i++)
 	{
 		UFlareCompany* Company = Companies[i];
 
 		//FLOGV("UFlareWorld::Save : saving company ('%s')", *Company->GetName());
-		FFlareCompanySave* TempData = Company->Save();
-		WorldData.CompanyData.Add(*TempData);
+		int32 CompanyIndex = Snapshot.CompanyData.AddDefaulted();
+		Company->Save(Snapshot.CompanyData[CompanyIndex]);
 	}
 
 	// Sectors
+	Snapshot.SectorData.Empty(Sectors.Num());
 	for (int i = 0; i < Sectors.Num(); i++)
 	{
 		UFlareSimulatedSector* Sector = Sectors[i];
 		//FLOGV("UFlareWorld::Save : saving sector ('%s')", *Sector->GetName());
 
-		WorldData.SectorData.Add(*Sector->Save());
+		Snapshot.SectorData.Add(*Sector->Save());
 	}
 
 	// Travels
+	Snapshot.TravelData.Empty(Travels.Num());
 	for (int i = 0; i < Travels.Num(); i++)
 	{
 		UFlareTravel* Travel = Travels[i];
 
 		//FLOGV("UFlareWorld::Save : saving travel for ('%s')", *Travel->GetFleet()->GetFleetName().ToString());
 		FFlareTravelSave* TempData = Travel->Save();
-		WorldData.TravelData.Add(*TempData);
+		Snapshot.TravelData.Add(*TempData);
+	}
+}
+
+void UFlareWorld::SaveRevisions(UFlareSaveGame* SaveGame)
+{
+	SaveGame->CompanyRevisions.Empty();
+	SaveGame->SectorRevisions.Empty();
+	SaveGame->SpacecraftRevisions.Empty();
+
+	for (int i = 0; i < Companies.Num(); i++)
+	{
+		UFlareCompany* Company = Companies[i];
+		SaveGame->CompanyRevisions.Add(Company->GetIdentifier(), Company->GetSaveRevision());
+
+		TArray<UFlareSimulatedSpacecraft*>& CompanySpacecrafts = Company->GetCompanySpacecrafts();
+		for (int j = 0; j < CompanySpacecrafts.Num(); j++)
+		{
+			UFlareSimulatedSpacecraft* Spacecraft = CompanySpacecrafts[j];
+			SaveGame->SpacecraftRevisions.Add(Spacecraft->GetImmatriculation(), Spacecraft->GetSaveRevision());
+		}
 	}
 
-	return &WorldData;
+	for (int i = 0; i < Sectors.Num(); i++)
+	{
+		SaveGame->SectorRevisions.Add(Sectors[i]->GetIdentifier(), Sectors[i]->GetSaveRevision());
+	}
 }
 
 
@@ -618,10 +676,17 @@ void UFlareWorld::Simulate()
 	}
 
 
+	EconomyVersion++;
+
 	double EndTs = FPlatformTime::Seconds();
 	FLOGV("** Simulate day %d done in %.6fs", WorldData.Date-1, EndTs- StartTs);
 
 	GameLog::DaySimulated(WorldData.Date);
+
+	if (Game->GetQuestManager())
+	{
+		Game->GetQuestManager()->OnWorldSimulated();
+	}
 }
 
 void UFlareWorld::ProcessShipCapture()
@@ -976,6 +1041,11 @@ void UFlareWorld::OnFleetSupplyConsumed(int32 Quantity)
 	WorldData.DailyFleetSupplyConsumption += Quantity;
 }
 
+void UFlareWorld::OnHostilityChanged()
+{
+	HostilityVersion++;
+}
+
 UFlareTravel* UFlareWorld::	StartTravel(UFlareFleet* TravelingFleet, UFlareSimulatedSector* DestinationSector)
 {
 	if (!TravelingFleet->CanTravel())
@@ -9,6 +9,7 @@
 
 
 struct FFlareSectorSave;
+class UFlareSaveGame;
 struct FFlareSectorDescription;
 
 class UFlareCompany;
@@ -86,8 +87,11 @@ public:
 	/** Loading is done */
 	virtual void PostLoad();
 
-	/** Save the company to a save file */
-	virtual FFlareWorldSave* Save();
+	/** Save the world to a save snapshot, copying the data of each object once */
+	virtual void Save(FFlareWorldSave& Snapshot);
+
+	/** Store the save revision of companies, sectors and spacecrafts, so that unchanged data can be reused */
+	void SaveRevisions(UFlareSaveGame* SaveGame);
 
 	/** Spawn a company from save data */
 	virtual UFlareCompany* LoadCompany(const FFlareCompanySave& CompanyData);
@@ -135,6 +139,9 @@ public:
 
 	void OnFleetSupplyConsumed(int32 Quantity);
 
+	/** Signal a change in the relations between companies */
+	void OnHostilityChanged();
+
 protected:
 
 	/*----------------------------------------------------
@@ -166,6 +173,12 @@ protected:
 
 	bool WorldMoneyReferenceInit;
 
+	// Incremented on each relation change, for caches
+	int32                                   HostilityVersion;
+
+	// Incremented on each simulated day, for caches
+	int32                                   EconomyVersion;
+
 public:
 	int64 WorldMoneyReference;
 
@@ -186,6 +199,16 @@ public:
 		return &WorldData;
 	}
 
+	inline int32 GetHostilityVersion() const
+	{
+		return HostilityVersion;
+	}
+
+	inline int32 GetEconomyVersion() const
+	{
+		return EconomyVersion;
+	}
+
 	inline UFlareSimulatedPlanetarium* GetPlanerarium()
 	{
 		return Planetarium;
@@ -8,7 +8,6 @@
 #include "../../Spacecrafts/FlareSpacecraft.h"
 #include "../FlareSimulatedSector.h"
 #include "../../Spacecrafts/FlareSimulatedSpacecraft.h"
-#include "../Save/FlareSaveWriter.h"
 
 // Game log api
 
@@ -56,26 +55,26 @@ void GameLog::AIConstructionStart(UFlareCompany* Company,
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Company->GetShortName().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Company->GetShortName();
 		Message.Params.Add(Param);
 	}
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = ConstructionProjectSector->GetIdentifier().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = ConstructionProjectSector->GetIdentifier();
 		Message.Params.Add(Param);
 	}
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = ConstructionProjectStationDescription->Identifier.ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = ConstructionProjectStationDescription->Identifier;
 		Message.Params.Add(Param);
 	}
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = (ConstructionProjectStation ? ConstructionProjectStation->GetImmatriculation().ToString() : "");
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = (ConstructionProjectStation ? ConstructionProjectStation->GetImmatriculation() : NAME_None);
 		Message.Params.Add(Param);
 	}
 
@@ -84,7 +83,7 @@ void GameLog::AIConstructionStart(UFlareCompany* Company,
 
 // Combat log api
 
-void CombatLog::SectorActivated(UFlareSimulatedSector* Sector)
+void CombatLog::SectorActivated(UFlareSimulatedSector* Sector, int32 SpacecraftCount, int32 FrameCount, float FirstFrameDuration, float TotalDuration)
 {
 	FlareLogMessage Message;
 	Message.Target = EFlareLogTarget::Combat;
@@ -92,8 +91,32 @@ void CombatLog::SectorActivated(UFlareSimulatedSector* Sector)
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Sector->GetIdentifier().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Sector->GetIdentifier();
+		Message.Params.Add(Param);
+	}
+	{
+		FlareLogMessageParam Param;
+		Param.Type = EFlareLogParam::Integer;
+		Param.IntValue = SpacecraftCount;
+		Message.Params.Add(Param);
+	}
+	{
+		FlareLogMessageParam Param;
+		Param.Type = EFlareLogParam::Integer;
+		Param.IntValue = FrameCount;
+		Message.Params.Add(Param);
+	}
+	{
+		FlareLogMessageParam Param;
+		Param.Type = EFlareLogParam::Float;
+		Param.FloatValue = FirstFrameDuration;
+		Message.Params.Add(Param);
+	}
+	{
+		FlareLogMessageParam Param;
+		Param.Type = EFlareLogParam::Float;
+		Param.FloatValue = TotalDuration;
 		Message.Params.Add(Param);
 	}
 
@@ -108,8 +131,8 @@ void CombatLog::SectorDeactivated(UFlareSimulatedSector* Sector)
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Sector->GetIdentifier().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Sector->GetIdentifier();
 		Message.Params.Add(Param);
 	}
 
@@ -124,8 +147,8 @@ void CombatLog::AutomaticBattleStarted(UFlareSimulatedSector* Sector)
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Sector->GetIdentifier().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Sector->GetIdentifier();
 		Message.Params.Add(Param);
 	}
 
@@ -140,8 +163,8 @@ void CombatLog::AutomaticBattleEnded(UFlareSimulatedSector* Sector)
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Sector->GetIdentifier().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Sector->GetIdentifier();
 		Message.Params.Add(Param);
 	}
 
@@ -156,29 +179,29 @@ void CombatLog::BombDropped(AFlareBomb *Bomb)
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Bomb->GetIdentifier().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Bomb->GetIdentifier();
 		Message.Params.Add(Param);
 	}
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Bomb->GetFiringSpacecraft()->GetImmatriculation().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Bomb->GetFiringSpacecraft()->GetImmatriculation();
 		Message.Params.Add(Param);
 	}
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Bomb->GetFiringWeapon()->Save()->ShipSlotIdentifier.ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Bomb->GetFiringWeapon()->Save()->ShipSlotIdentifier;
 		Message.Params.Add(Param);
 	}
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Bomb->GetFiringWeapon()->GetDescription()->Identifier.ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Bomb->GetFiringWeapon()->GetDescription()->Identifier;
 		Message.Params.Add(Param);
 	}
 
@@ -193,8 +216,8 @@ void CombatLog::BombDestroyed(FName BombIdentifier)
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = BombIdentifier.ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = BombIdentifier;
 		Message.Params.Add(Param);
 	}
 
@@ -209,15 +232,16 @@ void CombatLog::SpacecraftDamaged(UFlareSimulatedSpacecraft* Spacecraft, float E
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Spacecraft->GetImmatriculation().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Spacecraft->GetImmatriculation();
 		Message.Params.Add(Param);
 	}
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = UFlareSaveWriter::FormatEnum<EFlareDamage::Type>("EFlareDamage", DamageType);
+		Param.Type = EFlareLogParam::Enum;
+		Param.EnumName = TEXT("EFlareDamage");
+		Param.IntValue = DamageType;
 		Message.Params.Add(Param);
 	}
 
@@ -244,8 +268,8 @@ void CombatLog::SpacecraftDamaged(UFlareSimulatedSpacecraft* Spacecraft, float E
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue =  (DamageSource ? DamageSource->GetShortName().ToString() : "");
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = (DamageSource ? DamageSource->GetShortName() : NAME_None);
 		Message.Params.Add(Param);
 	}
 
@@ -260,22 +284,22 @@ void CombatLog::SpacecraftComponentDamaged(UFlareSimulatedSpacecraft* Spacecraft
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Spacecraft->GetImmatriculation().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Spacecraft->GetImmatriculation();
 		Message.Params.Add(Param);
 	}
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = ComponentData->ShipSlotIdentifier.ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = ComponentData->ShipSlotIdentifier;
 		Message.Params.Add(Param);
 	}
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = ComponentDescription->Identifier.ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = ComponentDescription->Identifier;
 		Message.Params.Add(Param);
 	}
 
@@ -295,8 +319,9 @@ void CombatLog::SpacecraftComponentDamaged(UFlareSimulatedSpacecraft* Spacecraft
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = UFlareSaveWriter::FormatEnum<EFlareDamage::Type>("EFlareDamage", DamageType);
+		Param.Type = EFlareLogParam::Enum;
+		Param.EnumName = TEXT("EFlareDamage");
+		Param.IntValue = DamageType;
 		Message.Params.Add(Param);
 	}
 
@@ -325,15 +350,15 @@ void CombatLog::SpacecraftHarpooned(UFlareSimulatedSpacecraft* Spacecraft, UFlar
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Spacecraft->GetImmatriculation().ToString();
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = Spacecraft->GetImmatriculation();
 		Message.Params.Add(Param);
 	}
 
 	{
 		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue =  (HarpoonOwner ? HarpoonOwner->GetShortName().ToString() : "");
+		Param.Type = EFlareLogParam::Name;
+		Param.NameValue = (HarpoonOwner ? HarpoonOwner->GetShortName() : NAME_None);
 		Message.Params.Add(Param);
 	}
 
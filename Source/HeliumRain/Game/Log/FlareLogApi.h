@@ -62,8 +62,12 @@ public:
 	 * Event: SECTOR_ACTIVATED
 	 * Params:
 	 *  - string : sector
+	 *  - integer : spawned spacecraft count
+	 *  - integer : frame count
+	 *  - float : first frame duration in milliseconds
+	 *  - float : total duration in milliseconds
 	 */
-	static void SectorActivated(UFlareSimulatedSector* Sector);
+	static void SectorActivated(UFlareSimulatedSector* Sector, int32 SpacecraftCount, int32 FrameCount, float FirstFrameDuration, float TotalDuration);
 
 	/**
 	 * The sector has been deactivated
@@ -3,6 +3,104 @@
 #include "FlareLogApi.h"
 #include "../Save/FlareSaveWriter.h"
 
+#define FLARE_LOG_RING_SIZE       4096
+#define FLARE_LOG_WAKE_RATIO      4
+#define FLARE_LOG_BLOCK_SIZE      65536
+#define FLARE_LOG_FLUSH_DELAY     1.0
+#define FLARE_LOG_FILE_MAGIC      0x474F4C46
+#define FLARE_LOG_FILE_VERSION    1
+
+#define FLARE_LOG_RECORD_STRING   0
+#define FLARE_LOG_RECORD_INTEGER  1
+#define FLARE_LOG_RECORD_FLOAT    2
+#define FLARE_LOG_RECORD_VECTOR3  3
+
+
+/*----------------------------------------------------
+	Message ring
+----------------------------------------------------*/
+
+FFlareLogMessageRing::FFlareLogMessageRing(uint32 Size)
+	: EnqueuePosition(0)
+	, DequeuePosition(0)
+{
+	FCHECK(FMath::IsPowerOfTwo(Size));
+
+	Cells.SetNum(Size);
+	Mask = Size - 1;
+
+	for (uint32 Index = 0; Index < Size; Index++)
+	{
+		Cells[Index].Sequence = Index;
+	}
+}
+
+bool FFlareLogMessageRing::Enqueue(const FlareLogMessage& Message)
+{
+	FFlareLogMessageCell* Cell;
+	int32 Position = EnqueuePosition;
+
+	// Reserve a cell, a cell is free when its sequence matches the position
+	while (true)
+	{
+		Cell = &Cells[Position & Mask];
+		int32 Sequence = Cell->Sequence;
+		FPlatformMisc::MemoryBarrier();
+		int32 Difference = Sequence - Position;
+
+		if (Difference == 0)
+		{
+			if (FPlatformAtomics::InterlockedCompareExchange(&EnqueuePosition, Position + 1, Position) == Position)
+			{
+				break;
+			}
+		}
+		else if (Difference < 0)
+		{
+			return false;
+		}
+
+		Position = EnqueuePosition;
+	}
+
+	// Publish the message
+	Cell->Message = Message;
+	FPlatformMisc::MemoryBarrier();
+	Cell->Sequence = Position + 1;
+
+	return true;
+}
+
+bool FFlareLogMessageRing::Dequeue(FlareLogMessage& Message)
+{
+	FFlareLogMessageCell* Cell = &Cells[DequeuePosition & Mask];
+	int32 Sequence = Cell->Sequence;
+	FPlatformMisc::MemoryBarrier();
+
+	if (Sequence - (DequeuePosition + 1) < 0)
+	{
+		return false;
+	}
+
+	// Release the cell for the next round
+	Message = Cell->Message;
+	FPlatformMisc::MemoryBarrier();
+	Cell->Sequence = DequeuePosition + Mask + 1;
+	DequeuePosition++;
+
+	return true;
+}
+
+uint32 FFlareLogMessageRing::Num() const
+{
+	return EnqueuePosition - DequeuePosition;
+}
+
+
+/*----------------------------------------------------
+	Log writer
+----------------------------------------------------*/
+
 //***********************************************************
 //Thread Worker Starts as NULL, prior to being instanced
 //		This line is essential! Compiler error without it
@@ -13,6 +111,8 @@ static int ThreadIndex = 0;
 
 FFlareLogWriter::FFlareLogWriter(FName UUID)
 	: StopTaskCounter(0),
+	  MessageQueue(FLARE_LOG_RING_SIZE),
+	  LastFlushTime(0),
 	  GameUUID(UUID)
 
 {
@@ -21,6 +121,9 @@ FFlareLogWriter::FFlareLogWriter(FName UUID)
 	GameLogFile = NULL;
 	CombatLogFile = NULL;
 
+	// Messages can be pushed before the thread starts
+	NewMessageEvent = FPlatformProcess::GetSynchEventFromPool(false);
+
 	Thread = FRunnableThread::Create(this, *Name, 0, TPri_BelowNormal); //windows default = 8mb for thread, could specify more
 	ThreadIndex++;
 }
@@ -40,9 +143,6 @@ FFlareLogWriter::~FFlareLogWriter()
 //Init
 bool FFlareLogWriter::Init()
 {
-	//Init the Data
-	NewMessageEvent = FPlatformProcess::GetSynchEventFromPool(false);
-
 	return true;
 }
 
@@ -51,21 +151,30 @@ uint32 FFlareLogWriter::Run()
 {
 	// Open log files
 	InitLogFiles();
+	LastFlushTime = FPlatformTime::Seconds();
 
-
-	//While not told to stop this thread
-	//		and not yet finished finding Prime Numbers
+	// Messages are written by blocks, once the ring fills up or after some delay
 	while (StopTaskCounter.GetValue() == 0)
 	{
-		NewMessageEvent->Wait();
+		NewMessageEvent->Wait((uint32) (FLARE_LOG_FLUSH_DELAY * 1000));
 
-		FlareLogMessage Message;
-		while (MessageQueue.Dequeue(Message))
+		WriteQueuedMessages();
+
+		if (FPlatformTime::Seconds() - LastFlushTime > FLARE_LOG_FLUSH_DELAY)
 		{
-			WriteMessage(Message);
+			FlushLogFiles();
 		}
 	}
 
+	// Write the last messages
+	WriteQueuedMessages();
+	FlushLogFiles();
+
+	if (OverflowMessageCount.GetValue() > 0)
+	{
+		FLOGV("FFlareLogWriter::Run : %d messages overflowed the log ring", OverflowMessageCount.GetValue());
+	}
+
 	CloseLogFiles();
 
 	return 0;
@@ -142,7 +251,7 @@ void FFlareLogWriter::CloseLogFiles()
 
 IFileHandle* FFlareLogWriter::InitLogFile(FString BaseName)
 {
-	FString FileName = FString::Printf(TEXT("%s/SaveGames/%s-%s.log"), *FPaths::GameSavedDir(), *BaseName, *GameUUID.ToString());
+	FString FileName = FString::Printf(TEXT("%s/SaveGames/%s-%s.flarelog"), *FPaths::GameSavedDir(), *BaseName, *GameUUID.ToString());
 
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 
@@ -153,30 +262,55 @@ IFileHandle* FFlareLogWriter::InitLogFile(FString BaseName)
 	{
 		FLOGV("Fail to init log file '%s' for base name '%s'", *FileName, *BaseName);
 	}
+	else if (FileHandle->Size() == 0)
+	{
+		TArray<uint8> Header;
+		EncodeValue<uint32>(FLARE_LOG_FILE_MAGIC, Header);
+		EncodeValue<uint32>(FLARE_LOG_FILE_VERSION, Header);
+		FileHandle->Write(Header.GetData(), Header.Num());
+	}
 
 	return FileHandle;
 }
 
-void FFlareLogWriter::WriteLine(IFileHandle* FileHandle, FString& Line)
+void FFlareLogWriter::FlushLogFile(IFileHandle* FileHandle, TArray<uint8>& Buffer)
+{
+	if (FileHandle && Buffer.Num())
+	{
+		FileHandle->Write(Buffer.GetData(), Buffer.Num());
+	}
+
+	Buffer.Reset();
+}
+
+void FFlareLogWriter::FlushLogFiles()
 {
-	FileHandle->Write((const uint8*)TCHAR_TO_ANSI(*Line), Line.Len());
+	FlushLogFile(GameLogFile, GameLogBuffer);
+	FlushLogFile(CombatLogFile, CombatLogBuffer);
+	LastFlushTime = FPlatformTime::Seconds();
 }
 
 void FFlareLogWriter::WriteMessage(FlareLogMessage& Message)
 {
-	FString MessageString = FormatMessage(Message);
-
 	switch (Message.Target) {
 	case EFlareLogTarget::Game:
 		if (GameLogFile)
 		{
-			WriteLine(GameLogFile, MessageString);
+			EncodeMessage(Message, GameLogBuffer);
+			if (GameLogBuffer.Num() >= FLARE_LOG_BLOCK_SIZE)
+			{
+				FlushLogFile(GameLogFile, GameLogBuffer);
+			}
 		}
 	break;
 	case EFlareLogTarget::Combat:
 		if (CombatLogFile)
 		{
-			WriteLine(CombatLogFile, MessageString);
+			EncodeMessage(Message, CombatLogBuffer);
+			if (CombatLogBuffer.Num() >= FLARE_LOG_BLOCK_SIZE)
+			{
+				FlushLogFile(CombatLogFile, CombatLogBuffer);
+			}
 		}
 		break;
 
@@ -185,56 +319,270 @@ void FFlareLogWriter::WriteMessage(FlareLogMessage& Message)
 	}
 }
 
-FString FFlareLogWriter::FormatMessage(FlareLogMessage& Message)
+void FFlareLogWriter::WriteQueuedMessages()
 {
+	FlareLogMessage Message;
 
-	FString MessageString = FString::Printf(
-				TEXT("%s %s"),
-				*Message.Date.ToString(TEXT("%Y-%m-%dT%H:%M:%S.%s")),
-				*UFlareSaveWriter::FormatEnum<EFlareLogEvent::Type>("EFlareLogEvent", Message.Event));
+	// Overflowed messages are newer than the ones in the ring
+	while (MessageQueue.Dequeue(Message))
+	{
+		WriteMessage(Message);
+	}
+
+	while (OverflowQueue.Dequeue(Message))
+	{
+		WriteMessage(Message);
+		PendingOverflowCount.Decrement();
+	}
+}
+
+void FFlareLogWriter::EncodeMessage(FlareLogMessage& Message, TArray<uint8>& Buffer)
+{
+	EncodeValue<int64>(Message.Date.GetTicks(), Buffer);
+	EncodeString(UFlareSaveWriter::FormatEnum<EFlareLogEvent::Type>("EFlareLogEvent", Message.Event), Buffer);
+	EncodeValue<uint8>(Message.Params.Num(), Buffer);
 
 	for(int32 ParamIndex = 0; ParamIndex < Message.Params.Num(); ParamIndex++)
 	{
-		MessageString += "," + FormatParam(&Message.Params[ParamIndex]);
+		FlareLogMessageParam* Param = &Message.Params[ParamIndex];
+
+		switch (Param->Type) {
+		case EFlareLogParam::Name:
+			EncodeValue<uint8>(FLARE_LOG_RECORD_STRING, Buffer);
+			EncodeString((Param->NameValue == NAME_None ? FString() : Param->NameValue.ToString()), Buffer);
+			break;
+		case EFlareLogParam::Enum:
+			EncodeValue<uint8>(FLARE_LOG_RECORD_STRING, Buffer);
+			EncodeString(UFlareSaveWriter::FormatEnum<int64>(Param->EnumName, Param->IntValue), Buffer);
+			break;
+		case EFlareLogParam::Integer:
+			EncodeValue<uint8>(FLARE_LOG_RECORD_INTEGER, Buffer);
+			EncodeValue<int64>(Param->IntValue, Buffer);
+			break;
+		case EFlareLogParam::Float:
+			EncodeValue<uint8>(FLARE_LOG_RECORD_FLOAT, Buffer);
+			EncodeValue<double>(Param->FloatValue, Buffer);
+			break;
+		case EFlareLogParam::Vector3:
+			EncodeValue<uint8>(FLARE_LOG_RECORD_VECTOR3, Buffer);
+			EncodeValue<float>(Param->Vector3Value.X, Buffer);
+			EncodeValue<float>(Param->Vector3Value.Y, Buffer);
+			EncodeValue<float>(Param->Vector3Value.Z, Buffer);
+			break;
+		default:
+			FLOGV("Invalid log param type %d", (Param->Type + 0));
+			EncodeValue<uint8>(FLARE_LOG_RECORD_STRING, Buffer);
+			EncodeString(FString(), Buffer);
+			break;
+		}
 	}
+}
 
-	MessageString += "\n";
-	return MessageString;
+void FFlareLogWriter::EncodeString(const FString& Value, TArray<uint8>& Buffer)
+{
+	FTCHARToUTF8 Converter(*Value);
+	const uint8* Bytes = reinterpret_cast<const uint8*>(Converter.Get());
+	int32 Length = Converter.Length();
+
+	// Truncate long strings before a UTF-8 continuation byte, so that no character is cut
+	if (Length > MAX_uint16)
+	{
+		Length = MAX_uint16;
+		while (Length > 0 && (Bytes[Length] & 0xC0) == 0x80)
+		{
+			Length--;
+		}
+	}
+
+	EncodeValue<uint16>(Length, Buffer);
+	Buffer.Append(Bytes, Length);
+}
+
+void FFlareLogWriter::PushMessage(FlareLogMessage& Message)
+{
+	Message.Date = FDateTime::UtcNow();
+
+	// Never block the game nor lose messages : when the writer is late, use the overflow queue until it catches up
+	if (PendingOverflowCount.GetValue() > 0 || !MessageQueue.Enqueue(Message))
+	{
+		PendingOverflowCount.Increment();
+		OverflowMessageCount.Increment();
+		OverflowQueue.Enqueue(Message);
+		NewMessageEvent->Trigger();
+	}
+	else if (MessageQueue.Num() > MessageQueue.GetSize() / FLARE_LOG_WAKE_RATIO)
+	{
+		NewMessageEvent->Trigger();
+	}
 }
 
-FString FFlareLogWriter::FormatParam(FlareLogMessageParam* Param)
+void FFlareLogWriter::PushWriterMessage(FlareLogMessage& Message)
 {
-	switch (Param->Type) {
-	case EFlareLogParam::String:
-		return "\""+Param->StringValue+"\"";
+	if (Runnable)
+	{
+		Runnable->PushMessage(Message);
+	}
+}
+
+
+/*----------------------------------------------------
+	Decoder
+----------------------------------------------------*/
+
+template<typename T>
+static bool DecodeLogValue(const TArray<uint8>& Data, int32& Offset, T& Value)
+{
+	if (Offset + (int32) sizeof(T) > Data.Num())
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(&Value, Data.GetData() + Offset, sizeof(T));
+	Offset += sizeof(T);
+	return true;
+}
+
+static bool DecodeLogString(const TArray<uint8>& Data, int32& Offset, FString& Value)
+{
+	uint16 Length;
+	if (!DecodeLogValue<uint16>(Data, Offset, Length) || Offset + Length > Data.Num())
+	{
+		return false;
+	}
+
+	TArray<ANSICHAR> Characters;
+	Characters.Append(reinterpret_cast<const ANSICHAR*>(Data.GetData() + Offset), Length);
+	Characters.Add(0);
+	Value = UTF8_TO_TCHAR(Characters.GetData());
+	Offset += Length;
+	return true;
+}
+
+static bool DecodeLogParam(const TArray<uint8>& Data, int32& Offset, FString& Value)
+{
+	uint8 Type;
+	if (!DecodeLogValue<uint8>(Data, Offset, Type))
+	{
+		return false;
+	}
+
+	switch (Type) {
+	case FLARE_LOG_RECORD_STRING:
+	{
+		FString String;
+		if (DecodeLogString(Data, Offset, String))
+		{
+			Value = "\"" + String + "\"";
+			return true;
+		}
 		break;
-	case EFlareLogParam::Integer:
-		return UFlareSaveWriter::FormatInt64(Param->IntValue);
+	}
+	case FLARE_LOG_RECORD_INTEGER:
+	{
+		int64 Integer;
+		if (DecodeLogValue<int64>(Data, Offset, Integer))
+		{
+			Value = UFlareSaveWriter::FormatInt64(Integer);
+			return true;
+		}
 		break;
-	case EFlareLogParam::Float:
-		return  FString::Printf(TEXT("%f"), Param->FloatValue);
+	}
+	case FLARE_LOG_RECORD_FLOAT:
+	{
+		double Float;
+		if (DecodeLogValue<double>(Data, Offset, Float))
+		{
+			Value = FString::Printf(TEXT("%f"), Float);
+			return true;
+		}
 		break;
-	case EFlareLogParam::Vector3:
-		return "("+UFlareSaveWriter::FormatVector(Param->Vector3Value)+")";
+	}
+	case FLARE_LOG_RECORD_VECTOR3:
+	{
+		FVector Vector;
+		if (DecodeLogValue<float>(Data, Offset, Vector.X)
+		 && DecodeLogValue<float>(Data, Offset, Vector.Y)
+		 && DecodeLogValue<float>(Data, Offset, Vector.Z))
+		{
+			Value = "(" + UFlareSaveWriter::FormatVector(Vector) + ")";
+			return true;
+		}
 		break;
+	}
 	default:
-		FLOGV("Invalid log param type %d", (Param->Type + 0));
+		FLOGV("Invalid log record param type %d", Type);
 		break;
 	}
-	return "";
+
+	return false;
 }
 
-void FFlareLogWriter::PushMessage(FlareLogMessage& Message)
+bool FFlareLogWriter::DecodeLogFile(FString InputFileName, FString OutputFileName)
 {
-	Message.Date = FDateTime::UtcNow();
-	MessageQueue.Enqueue(Message);
-	NewMessageEvent->Trigger();
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *InputFileName))
+	{
+		FLOGV("FFlareLogWriter::DecodeLogFile : fail to read '%s'", *InputFileName);
+		return false;
+	}
+
+	int32 Offset = 0;
+	uint32 Magic;
+	uint32 Version;
+	if (!DecodeLogValue<uint32>(Data, Offset, Magic) || Magic != FLARE_LOG_FILE_MAGIC
+	 || !DecodeLogValue<uint32>(Data, Offset, Version) || Version != FLARE_LOG_FILE_VERSION)
+	{
+		FLOGV("FFlareLogWriter::DecodeLogFile : '%s' is not a log file", *InputFileName);
+		return false;
+	}
+
+	FString Output;
+	while (Offset < Data.Num())
+	{
+		int64 Ticks;
+		FString Event;
+		uint8 ParamCount;
+
+		if (!DecodeLogValue<int64>(Data, Offset, Ticks)
+		 || !DecodeLogString(Data, Offset, Event)
+		 || !DecodeLogValue<uint8>(Data, Offset, ParamCount))
+		{
+			FLOGV("FFlareLogWriter::DecodeLogFile : truncated record in '%s'", *InputFileName);
+			break;
+		}
+
+		TArray<FString> Params;
+		Params.SetNum(ParamCount);
+		bool ParamsValid = true;
+		for (int32 ParamIndex = 0; ParamIndex < ParamCount && ParamsValid; ParamIndex++)
+		{
+			ParamsValid = DecodeLogParam(Data, Offset, Params[ParamIndex]);
+		}
+
+		if (!ParamsValid)
+		{
+			FLOGV("FFlareLogWriter::DecodeLogFile : truncated record in '%s'", *InputFileName);
+			break;
+		}
+
+		Output += FormatMessage(FDateTime(Ticks), Event, Params);
+	}
+
+	return FFileHelper::SaveStringToFile(Output, *OutputFileName, FFileHelper::EEncodingOptions::ForceAnsi);
 }
 
-void FFlareLogWriter::PushWriterMessage(FlareLogMessage& Message)
+FString FFlareLogWriter::FormatMessage(FDateTime Date, FString Event, TArray<FString>& Params)
 {
-	if (Runnable)
+	FString MessageString = FString::Printf(
+				TEXT("%s %s"),
+				*Date.ToString(TEXT("%Y-%m-%dT%H:%M:%S.%s")),
+				*Event);
+
+	for(int32 ParamIndex = 0; ParamIndex < Params.Num(); ParamIndex++)
 	{
-		Runnable->PushMessage(Message);
+		MessageString += "," + Params[ParamIndex];
 	}
+
+	MessageString += "\n";
+	return MessageString;
 }
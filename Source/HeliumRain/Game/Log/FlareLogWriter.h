@@ -42,28 +42,71 @@ namespace EFlareLogParam
 {
 	enum Type
 	{
-		String,
+		Name,
 		Integer,
 		Float,
 		Vector3,
+		Enum,
 	};
 }
 
+/** Maximum parameter count of a log message */
+#define FLARE_LOG_MAX_PARAMS 8
+
+/** Log message parameter, stored without any allocation and formatted by the writer thread */
 struct FlareLogMessageParam
 {
 	EFlareLogParam::Type Type;
-	FString StringValue;
+	FName NameValue;
+	const TCHAR* EnumName;
 	int64 IntValue;
 	double FloatValue;
 	FVector Vector3Value;
 };
 
+/** Fixed-size log message record */
 struct FlareLogMessage
 {
 	FDateTime Date;
 	EFlareLogTarget::Type Target;
 	EFlareLogEvent::Type Event;
-	TArray<FlareLogMessageParam> Params;
+	TArray<FlareLogMessageParam, TFixedAllocator<FLARE_LOG_MAX_PARAMS>> Params;
+};
+
+
+/** Bounded lock-free queue of log messages, with any number of producers and a single consumer */
+class FFlareLogMessageRing
+{
+public:
+
+	FFlareLogMessageRing(uint32 Size);
+
+	/** Add a message, return false if the ring is full */
+	bool Enqueue(const FlareLogMessage& Message);
+
+	/** Get the oldest message, from the consumer thread */
+	bool Dequeue(FlareLogMessage& Message);
+
+	/** Get the approximate message count */
+	uint32 Num() const;
+
+	inline uint32 GetSize() const
+	{
+		return Cells.Num();
+	}
+
+private:
+
+	struct FFlareLogMessageCell
+	{
+		volatile int32 Sequence;
+		FlareLogMessage Message;
+	};
+
+	TArray<FFlareLogMessageCell> Cells;
+	uint32                       Mask;
+	volatile int32               EnqueuePosition;
+	volatile int32               DequeuePosition;
 };
 
 
@@ -86,20 +129,38 @@ class FFlareLogWriter : public FRunnable
 
 	IFileHandle* InitLogFile(FString BaseName);
 
-	void WriteLine(IFileHandle* FileHandle, FString& Line);
+	void FlushLogFile(IFileHandle* FileHandle, TArray<uint8>& Buffer);
+
+	void FlushLogFiles();
 
 	void WriteMessage(FlareLogMessage& Message);
 
-	FString FormatMessage(FlareLogMessage& Message);
+	/** Write the messages of the ring, then the ones that overflowed it */
+	void WriteQueuedMessages();
+
+	/** Encode a message to the binary log format */
+	static void EncodeMessage(FlareLogMessage& Message, TArray<uint8>& Buffer);
+
+	static void EncodeString(const FString& Value, TArray<uint8>& Buffer);
 
-	FString FormatParam(FlareLogMessageParam* Param);
+	template<typename T>
+	static void EncodeValue(T Value, TArray<uint8>& Buffer)
+	{
+		Buffer.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
 
 private:
 	int32					PrimesFoundCount;
 	FEvent*					NewMessageEvent;
-	TQueue<FlareLogMessage>	MessageQueue;
+	FFlareLogMessageRing	MessageQueue;
+	TQueue<FlareLogMessage, EQueueMode::Mpsc> OverflowQueue;
+	FThreadSafeCounter		PendingOverflowCount;
+	FThreadSafeCounter		OverflowMessageCount;
 	IFileHandle*			GameLogFile;
 	IFileHandle*			CombatLogFile;
+	TArray<uint8>			GameLogBuffer;
+	TArray<uint8>			CombatLogBuffer;
+	double					LastFlushTime;
 	FName					GameUUID;
 
 public:
@@ -139,4 +200,10 @@ public:
 	/** Shuts down the thread. Static so it can easily be called from outside the thread context */
 	static void Shutdown();
 
+	/** Convert a binary log file to the text format */
+	static bool DecodeLogFile(FString InputFileName, FString OutputFileName);
+
+	/** Format a message in the text format */
+	static FString FormatMessage(FDateTime Date, FString Event, TArray<FString>& Params);
+
 };
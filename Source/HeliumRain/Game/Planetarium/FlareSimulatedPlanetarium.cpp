@@ -87,6 +87,32 @@ void UFlareSimulatedPlanetarium::Load()
 		Nema.Sattelites.Add(Adena);
 	}
 	Sun.Sattelites.Add(Nema);
+
+	// The tree is complete : body pointers are now stable
+	Bodies.Empty();
+	IndexCelestialBody(&Sun, INDEX_NONE);
+}
+
+void UFlareSimulatedPlanetarium::IndexCelestialBody(FFlareCelestialBody* Body, int32 ParentIndex)
+{
+	Body->ParentIndex = ParentIndex;
+	Body->RotationPeriod = (Body->RotationVelocity != 0 ? 360 / Body->RotationVelocity : 0);
+
+	if (ParentIndex != INDEX_NONE)
+	{
+		Body->RevolutionTime = GetRevolutionTime(Bodies[ParentIndex], Body->OrbitDistance, Body->Mass, &Body->OrbitalVelocity);
+	}
+	else
+	{
+		Body->RevolutionTime = 0;
+		Body->OrbitalVelocity = 0;
+	}
+
+	int32 BodyIndex = Bodies.Add(Body);
+	for (int SatteliteIndex = 0; SatteliteIndex < Body->Sattelites.Num(); SatteliteIndex++)
+	{
+		IndexCelestialBody(&Body->Sattelites[SatteliteIndex], BodyIndex);
+	}
 }
 
 
@@ -163,23 +189,58 @@ float UFlareSimulatedPlanetarium::GetLightRatio(FFlareCelestialBody* Body, doubl
 	return 0.5 + FMath::Acos(Body->Radius / (Body->Radius + OrbitDistance)) / PI;
 }
 
-FFlareCelestialBody UFlareSimulatedPlanetarium::GetSnapShot(int64 Time, float SmoothTime)
+const FFlareCelestialBody* UFlareSimulatedPlanetarium::GetSnapShot(int64 Time, float SmoothTime)
 {
-	ComputeCelestialBodyLocation(NULL, &Sun, Time, SmoothTime);
-	return Sun;
+	// Parents are always updated before their sattelites
+	for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); BodyIndex++)
+	{
+		FFlareCelestialBody* Body = Bodies[BodyIndex];
+
+		if (Body->ParentIndex != INDEX_NONE)
+		{
+			Body->RelativeLocation = GetOrbitLocation(Body->RevolutionTime, Time, SmoothTime, Body->OrbitDistance, 0);
+			Body->AbsoluteLocation = Bodies[Body->ParentIndex]->AbsoluteLocation + Body->RelativeLocation;
+		}
+
+		if (Body->RotationPeriod)
+		{
+			Body->RotationAngle = FPreciseMath::UnwindDegrees(Body->RotationVelocity * (Time % Body->RotationPeriod)) + Body->RotationVelocity * SmoothTime;
+		}
+		else
+		{
+			Body->RotationAngle = 0;
+		}
+	}
+
+	return &Sun;
 }
 
 FPreciseVector UFlareSimulatedPlanetarium::GetRelativeLocation(FFlareCelestialBody* ParentBody, int64 Time, float SmoothTime, double OrbitDistance, double Mass, double InitialPhase)
+{
+	int64 RevolutionTime = GetRevolutionTime(ParentBody, OrbitDistance, Mass);
+	return GetOrbitLocation(RevolutionTime, Time, SmoothTime, OrbitDistance, InitialPhase);
+}
+
+int64 UFlareSimulatedPlanetarium::GetRevolutionTime(FFlareCelestialBody* ParentBody, double OrbitDistance, double Mass, double* OrbitalVelocity)
 {
 	// TODO extract the constant
 	double G = 6.674e-11; // Gravitational constant
 
 	double MassSum = ParentBody->Mass + Mass;
-	double OrbitalVelocity = FPreciseMath::Sqrt(G * ((MassSum) / (1000 * OrbitDistance)));
+	double Velocity = FPreciseMath::Sqrt(G * ((MassSum) / (1000 * OrbitDistance)));
 
 	double OrbitalCircumference = 2 * PI * 1000 * OrbitDistance;
-	int64 RevolutionTime = (int64) (OrbitalCircumference / OrbitalVelocity);
 
+	if (OrbitalVelocity)
+	{
+		*OrbitalVelocity = Velocity;
+	}
+
+	return (int64) (OrbitalCircumference / Velocity);
+}
+
+FPreciseVector UFlareSimulatedPlanetarium::GetOrbitLocation(int64 RevolutionTime, int64 Time, float SmoothTime, double OrbitDistance, double InitialPhase)
+{
 	double CurrentRevolutionTime = fmod(((double) (Time % RevolutionTime) + SmoothTime), (double) RevolutionTime);
 
 	double Phase = (360 * CurrentRevolutionTime / (double) RevolutionTime) + InitialPhase;
@@ -193,25 +254,6 @@ FPreciseVector UFlareSimulatedPlanetarium::GetRelativeLocation(FFlareCelestialBo
 	return RelativeLocation;
 }
 
-
-void UFlareSimulatedPlanetarium::ComputeCelestialBodyLocation(FFlareCelestialBody* ParentBody, FFlareCelestialBody* Body, int64 Time, float SmoothTime)
-{
-	if (ParentBody)
-	{
-		Body->RelativeLocation = GetRelativeLocation(ParentBody, Time, SmoothTime, Body->OrbitDistance, Body->Mass, 0);
-		Body->AbsoluteLocation = ParentBody->AbsoluteLocation + Body->RelativeLocation;
-	}
-
-	int64 RotationPeriod = 360/Body->RotationVelocity;
-
-	Body->RotationAngle = FPreciseMath::UnwindDegrees(Body->RotationVelocity * (Time % RotationPeriod)) + Body->RotationVelocity * SmoothTime;
-	for (int SatteliteIndex = 0; SatteliteIndex < Body->Sattelites.Num(); SatteliteIndex++)
-	{
-		FFlareCelestialBody* CelestialBody = &Body->Sattelites[SatteliteIndex];
-		ComputeCelestialBodyLocation(Body, CelestialBody, Time, SmoothTime);
-	}
-}
-
 AFlareGame* UFlareSimulatedPlanetarium::GetGame() const
 {
 	return Game;
@@ -204,6 +204,18 @@ struct FFlareCelestialBody
 	/** Sattelites list */
 	TArray<FFlareCelestialBody> Sattelites;
 
+	/** Orbital velocity around the parent body, computed at load. In m/s */
+	double OrbitalVelocity;
+
+	/** Revolution period around the parent body, computed at load. In s */
+	int64 RevolutionTime;
+
+	/** Self rotation period, computed at load. In s */
+	int64 RotationPeriod;
+
+	/** Index of the parent body in the flat body list, or INDEX_NONE for the root star */
+	int32 ParentIndex;
+
 	/*----------------------------------------------------
 		Dynamic parameters
 	----------------------------------------------------*/
@@ -231,12 +243,18 @@ public:
 	virtual void Load();
 
 
-	/** Load the planetarium */
-	virtual FFlareCelestialBody GetSnapShot(int64 Time, float SmoothTime);
+	/** Compute the location of all bodies in place, and return the root star */
+	virtual const FFlareCelestialBody* GetSnapShot(int64 Time, float SmoothTime);
 
 	/** Get relative location of a body orbiting around its parent */
 	virtual FPreciseVector GetRelativeLocation(FFlareCelestialBody* ParentBody, int64 Time, float SmoothTime, double OrbitDistance, double Mass, double InitialPhase);
 
+	/** Get the revolution period of a body orbiting around its parent */
+	static int64 GetRevolutionTime(FFlareCelestialBody* ParentBody, double OrbitDistance, double Mass, double* OrbitalVelocity = NULL);
+
+	/** Get relative location of a body orbiting with a known revolution period */
+	static FPreciseVector GetOrbitLocation(int64 RevolutionTime, int64 Time, float SmoothTime, double OrbitDistance, double InitialPhase);
+
 	/** Return the celestial body with the given identifier */
 	FFlareCelestialBody* FindCelestialBody(FName BodyIdentifier);
 
@@ -256,7 +274,8 @@ public:
 
 protected:
 
-	void ComputeCelestialBodyLocation(FFlareCelestialBody* ParentBody, FFlareCelestialBody* Body, int64 time, float SmoothTime);
+	/** Build the flat body list and the cached orbit parameters */
+	void IndexCelestialBody(FFlareCelestialBody* Body, int32 ParentIndex);
 
 	/*----------------------------------------------------
 		Protected data
@@ -266,6 +285,9 @@ protected:
 
 	FFlareCelestialBody           Sun;
 
+	// All bodies, parents first
+	TArray<FFlareCelestialBody*>  Bodies;
+
 public:
 
 	/*----------------------------------------------------
@@ -274,6 +296,12 @@ public:
 
 	AFlareGame* GetGame() const;
 
+	/** Get all bodies, parents first */
+	inline const TArray<FFlareCelestialBody*>& GetBodies() const
+	{
+		return Bodies;
+	}
+
 
 
 };
@@ -0,0 +1,106 @@
+
+#include "../../Flare.h"
+#include "FlareSaveCache.h"
+
+
+uint64 FFlareSaveCache::LastRevision = 0;
+
+
+/*----------------------------------------------------
+	Interaction
+----------------------------------------------------*/
+
+FFlareSaveCache::FFlareSaveCache()
+	: SaveIndex(0)
+	, ReusedCount(0)
+	, EncodedCount(0)
+{
+}
+
+uint64 FFlareSaveCache::NewRevision()
+{
+	FCHECK(IsInGameThread());
+	return ++LastRevision;
+}
+
+TSharedPtr<FJsonObject> FFlareSaveCache::Find(FName Identifier, uint64 Revision)
+{
+	FScopeLock Lock(&EntriesLock);
+	FFlareSaveCacheEntry* Entry = FindEntry(Identifier, Revision);
+	return (Entry ? Entry->Fragment : TSharedPtr<FJsonObject>());
+}
+
+void FFlareSaveCache::Add(FName Identifier, uint64 Revision, TSharedPtr<FJsonObject> Fragment)
+{
+	FScopeLock Lock(&EntriesLock);
+	AddEntry(Identifier, Revision).Fragment = Fragment;
+}
+
+TSharedPtr<FString> FFlareSaveCache::FindText(FName Identifier, uint64 Revision)
+{
+	FScopeLock Lock(&EntriesLock);
+	FFlareSaveCacheEntry* Entry = FindEntry(Identifier, Revision);
+	return (Entry ? Entry->Text : TSharedPtr<FString>());
+}
+
+void FFlareSaveCache::AddText(FName Identifier, uint64 Revision, TSharedPtr<FString> Text)
+{
+	FScopeLock Lock(&EntriesLock);
+	AddEntry(Identifier, Revision).Text = Text;
+}
+
+void FFlareSaveCache::BeginSave()
+{
+	SaveIndex++;
+	ReusedCount = 0;
+	EncodedCount = 0;
+}
+
+void FFlareSaveCache::EndSave()
+{
+	for (auto Iterator = Entries.CreateIterator(); Iterator; ++Iterator)
+	{
+		if (Iterator.Value().LastSaveIndex != SaveIndex)
+		{
+			Iterator.RemoveCurrent();
+		}
+	}
+}
+
+void FFlareSaveCache::Reset()
+{
+	Entries.Empty();
+	ReusedCount = 0;
+	EncodedCount = 0;
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+FFlareSaveCache::FFlareSaveCacheEntry* FFlareSaveCache::FindEntry(FName Identifier, uint64 Revision)
+{
+	FFlareSaveCacheEntry* Entry = Entries.Find(Identifier);
+
+	// Revision 0 is used for objects without any known revision
+	if (Entry && Revision != 0 && Entry->Revision == Revision)
+	{
+		Entry->LastSaveIndex = SaveIndex;
+		ReusedCount++;
+		return Entry;
+	}
+
+	return NULL;
+}
+
+FFlareSaveCache::FFlareSaveCacheEntry& FFlareSaveCache::AddEntry(FName Identifier, uint64 Revision)
+{
+	FFlareSaveCacheEntry& Entry = Entries.FindOrAdd(Identifier);
+	Entry.Revision = Revision;
+	Entry.LastSaveIndex = SaveIndex;
+	Entry.Fragment.Reset();
+	Entry.Text.Reset();
+	EncodedCount++;
+	return Entry;
+}
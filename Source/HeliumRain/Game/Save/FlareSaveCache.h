@@ -0,0 +1,117 @@
+#pragma once
+
+#include "../../Flare.h"
+
+
+/** Serialized save data of world objects, reused by the next save while the object is unchanged. Find and Add can be called from several threads. */
+class FFlareSaveCache
+{
+public:
+
+	/*----------------------------------------------------
+		Interaction
+	----------------------------------------------------*/
+
+	FFlareSaveCache();
+
+	/** Get a save revision that was never used before in this session, to be called from the game thread */
+	static uint64 NewRevision();
+
+	/** Get the serialized data of an object if it was stored at this revision */
+	TSharedPtr<FJsonObject> Find(FName Identifier, uint64 Revision);
+
+	/** Store the serialized data of an object at this revision */
+	void Add(FName Identifier, uint64 Revision, TSharedPtr<FJsonObject> Fragment);
+
+	/** Get the JSON text of an object if it was stored at this revision */
+	TSharedPtr<FString> FindText(FName Identifier, uint64 Revision);
+
+	/** Store the JSON text of an object at this revision */
+	void AddText(FName Identifier, uint64 Revision, TSharedPtr<FString> Text);
+
+	/** Start using the cache for a new save */
+	void BeginSave();
+
+	/** Drop the objects that were not part of the save that just ended */
+	void EndSave();
+
+	/** Drop all cached data */
+	void Reset();
+
+	/** Check if two save structures hold the same values */
+	template<typename T>
+	static bool IsSameData(const T& A, const T& B)
+	{
+		return T::StaticStruct()->CompareScriptStruct(&A, &B, 0);
+	}
+
+	/** Check if two arrays of save structures hold the same values */
+	template<typename T>
+	static bool IsSameData(const TArray<T>& A, const TArray<T>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < A.Num(); Index++)
+		{
+			if (!IsSameData(A[Index], B[Index]))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+
+protected:
+
+	/*----------------------------------------------------
+		Protected data
+	----------------------------------------------------*/
+
+	/** Serialized data of an object, as a JSON object or as JSON text */
+	struct FFlareSaveCacheEntry
+	{
+		uint64                                      Revision;
+		uint32                                      LastSaveIndex;
+		TSharedPtr<FJsonObject>                     Fragment;
+		TSharedPtr<FString>                         Text;
+	};
+
+	/** Get the entry of an object if it was stored at this revision, and mark it as used */
+	FFlareSaveCacheEntry* FindEntry(FName Identifier, uint64 Revision);
+
+	/** Get the entry of an object to store it at this revision */
+	FFlareSaveCacheEntry& AddEntry(FName Identifier, uint64 Revision);
+
+	FCriticalSection                                EntriesLock;
+	TMap<FName, FFlareSaveCacheEntry>               Entries;
+	uint32                                          SaveIndex;
+	int32                                           ReusedCount;
+	int32                                           EncodedCount;
+
+	static uint64                                   LastRevision;
+
+
+public:
+
+	/*----------------------------------------------------
+		Getters
+	----------------------------------------------------*/
+
+	/** Number of objects reused by the current save */
+	inline int32 GetReusedCount() const
+	{
+		return ReusedCount;
+	}
+
+	/** Number of objects serialized again by the current save */
+	inline int32 GetEncodedCount() const
+	{
+		return EncodedCount;
+	}
+
+};
@@ -6,6 +6,43 @@
 #include "FlareSaveReaderV1.h"
 #include "../FlareGame.h"
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FlareSave Queue depth"), STAT_FlareSave_QueueDepth, STATGROUP_Flare);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FlareSave Dropped saves"), STAT_FlareSave_DroppedSaves, STATGROUP_Flare);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("FlareSave Write latency (ms)"), STAT_FlareSave_WriteLatency, STATGROUP_Flare);
+
+
+/*----------------------------------------------------
+	Background save task
+----------------------------------------------------*/
+
+class FAsyncSave : public FNonAbandonableTask
+{
+	friend class FAutoDeleteAsyncTask<FAsyncSave>;
+public:
+	FAsyncSave(UFlareSaveGameSystem* SaveSystemParam, const FString SaveNameParam) :
+		SaveName(SaveNameParam),
+		SaveSystem(SaveSystemParam)
+	{}
+
+protected:
+	FString SaveName;
+	UFlareSaveGameSystem* SaveSystem;
+
+	void DoWork()
+	{
+		FLOGC(LogFlareSave, "Async save start");
+		SaveSystem->ProcessSaveQueue(SaveName);
+		FLOGC(LogFlareSave, "Async save end");
+	}
+
+	// This next section of code needs to be here.  Not important as to why.
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FAsyncSave, STATGROUP_ThreadPoolAsyncTasks);
+	}
+};
+
 
 /*----------------------------------------------------
 	Constructor
@@ -27,25 +64,65 @@ bool UFlareSaveGameSystem::DoesSaveGameExist(const FString SaveName)
 }
 
 bool UFlareSaveGameSystem::SaveGame(const FString SaveName, UFlareSaveGame* SaveData)
+{
+	return WriteSave(SaveName, SaveData, -1);
+}
+
+bool UFlareSaveGameSystem::WriteSave(const FString SaveName, UFlareSaveGame* SaveData, int32 Generation)
 {
 	bool ret = false;
 	SaveLock.Lock();
-	FLOGV("UFlareSaveGameSystem::SaveGame SaveName=%s", *SaveName);
+	FLOGCV(LogFlareSave, "UFlareSaveGameSystem::SaveGame SaveName=%s", *SaveName);
 
-	UFlareSaveWriter* SaveWriter = NewObject<UFlareSaveWriter>(this, UFlareSaveWriter::StaticClass());
-	TSharedRef<FJsonObject> JsonObject = SaveWriter->SaveGame(SaveData);
+	// A newer save for this slot was requested since this data was taken from the queue
+	if (Generation >= 0)
+	{
+		SaveQueueLock.Lock();
+		bool Superseded = (SaveGenerations.FindRef(SaveName) != Generation);
+		SaveQueueLock.Unlock();
+
+		if (Superseded)
+		{
+			FLOGCV(LogFlareSave, "UFlareSaveGameSystem::SaveGame : dropping superseded save for %s", *SaveName);
+			INC_DWORD_STAT(STAT_FlareSave_DroppedSaves);
+			SaveLock.Unlock();
 
-	// Save the json object
+			SaveListLock.Lock();
+			SaveList.Remove(SaveData);
+			SaveListLock.Unlock();
+
+			return false;
+		}
+	}
+
+	CompanyCache.BeginSave();
+	SectorCache.BeginSave();
+	SpacecraftCache.BeginSave();
+
+	// Save the json text, reusing the text of unchanged objects
 	FString FileContents;
-	//TSharedRef< TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> > JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&FileContents);
-	TSharedRef< TJsonWriter<> > JsonWriter = TJsonWriterFactory<>::Create(&FileContents);
+	UFlareSaveWriter* SaveWriter = NewObject<UFlareSaveWriter>(this, UFlareSaveWriter::StaticClass());
+	SaveWriter->SetCaches(&CompanyCache, &SectorCache, &SpacecraftCache);
+	bool Serialized = SaveWriter->SaveGameToString(SaveData, FileContents);
 
-	if (FJsonSerializer::Serialize(JsonObject, JsonWriter))
+	CompanyCache.EndSave();
+	SectorCache.EndSave();
+	SpacecraftCache.EndSave();
+
+	FLOGCV(LogFlareSave, "UFlareSaveGameSystem::SaveGame : reused %d/%d companies, %d/%d sectors, %d/%d spacecrafts",
+		CompanyCache.GetReusedCount(), CompanyCache.GetReusedCount() + CompanyCache.GetEncodedCount(),
+		SectorCache.GetReusedCount(), SectorCache.GetReusedCount() + SectorCache.GetEncodedCount(),
+		SpacecraftCache.GetReusedCount(), SpacecraftCache.GetReusedCount() + SpacecraftCache.GetEncodedCount());
+
+	if (Serialized && UFlareGameTools::SaveCacheCheck)
 	{
-		JsonWriter->Close();
+		CheckCachedSave(SaveData, FileContents);
+	}
 
+	if (Serialized)
+	{
 		ret = FFileHelper::SaveStringToFile(FileContents, *GetSaveGamePath(SaveName));
-		FLOG("UFlareSaveGameSystem::SaveGame : Save done");
+		FLOGC(LogFlareSave, "UFlareSaveGameSystem::SaveGame : Save done");
 	}
 	else
 	{
@@ -62,9 +139,41 @@ bool UFlareSaveGameSystem::SaveGame(const FString SaveName, UFlareSaveGame* Save
 	return ret;
 }
 
+void UFlareSaveGameSystem::CheckCachedSave(UFlareSaveGame* SaveData, FString& FileContents)
+{
+	FString FreshContents;
+	UFlareSaveWriter* SaveWriter = NewObject<UFlareSaveWriter>(this, UFlareSaveWriter::StaticClass());
+
+	if (!SaveWriter->SaveGameToString(SaveData, FreshContents))
+	{
+		FLOG("UFlareSaveGameSystem::CheckCachedSave : failed to serialize the fresh save");
+		return;
+	}
+
+	if (FreshContents.Equals(FileContents, ESearchCase::CaseSensitive))
+	{
+		FLOGC(LogFlareSave, "UFlareSaveGameSystem::CheckCachedSave : cached save is identical");
+		return;
+	}
+
+	// Find the first difference and show both versions around it
+	int32 Offset = 0;
+	while (Offset < FileContents.Len() && Offset < FreshContents.Len() && FileContents[Offset] == FreshContents[Offset])
+	{
+		Offset++;
+	}
+
+	int32 ContextStart = FMath::Max(0, Offset - 100);
+	FLOGV("UFlareSaveGameSystem::CheckCachedSave : cached save differs at character %d", Offset);
+	FLOGV("UFlareSaveGameSystem::CheckCachedSave : cached '%s'", *FileContents.Mid(ContextStart, 200));
+	FLOGV("UFlareSaveGameSystem::CheckCachedSave : fresh '%s'", *FreshContents.Mid(ContextStart, 200));
+
+	FileContents = FreshContents;
+}
+
 UFlareSaveGame* UFlareSaveGameSystem::LoadGame(const FString SaveName)
 {
-	FLOGV("UFlareSaveGameSystem::LoadGame SaveName=%s", *SaveName);
+	FLOGCV(LogFlareSave, "UFlareSaveGameSystem::LoadGame SaveName=%s", *SaveName);
 
 	UFlareSaveGame *SaveGame = NULL;
 
@@ -95,7 +204,14 @@ UFlareSaveGame* UFlareSaveGameSystem::LoadGame(const FString SaveName)
 
 bool UFlareSaveGameSystem::DeleteGame(const FString SaveName)
 {
-	return IFileManager::Get().Delete(*GetSaveGamePath(SaveName), true);
+	CancelQueuedSave(SaveName);
+
+	// Wait for a write in progress so that it can't recreate the file
+	SaveLock.Lock();
+	bool Result = IFileManager::Get().Delete(*GetSaveGamePath(SaveName), true);
+	SaveLock.Unlock();
+
+	return Result;
 }
 
 
@@ -106,6 +222,109 @@ void UFlareSaveGameSystem::PushSaveData(UFlareSaveGame* SaveData)
 	SaveListLock.Unlock();
 }
 
+void UFlareSaveGameSystem::QueueSave(const FString SaveName, UFlareSaveGame* SaveData)
+{
+	PushSaveData(SaveData);
+
+	SaveQueueLock.Lock();
+
+	// Only the newest data is worth writing
+	UFlareSaveGame* SupersededData = QueuedSaves.FindRef(SaveName);
+	if (SupersededData)
+	{
+		FLOGCV(LogFlareSave, "UFlareSaveGameSystem::QueueSave : dropping superseded save for %s", *SaveName);
+		SaveListLock.Lock();
+		SaveList.Remove(SupersededData);
+		SaveListLock.Unlock();
+		INC_DWORD_STAT(STAT_FlareSave_DroppedSaves);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_FlareSave_QueueDepth);
+		QueuedSaveTimes.Add(SaveName, FPlatformTime::Seconds());
+	}
+	QueuedSaves.Add(SaveName, SaveData);
+	QueuedSaveGenerations.Add(SaveName, ++SaveGenerations.FindOrAdd(SaveName));
+
+	// A running task will write the new data once done with the previous one
+	bool StartTask = !ProcessedSlots.Contains(SaveName);
+	if (StartTask)
+	{
+		ProcessedSlots.Add(SaveName);
+	}
+
+	SaveQueueLock.Unlock();
+
+	if (StartTask)
+	{
+		(new FAutoDeleteAsyncTask<FAsyncSave>(this, SaveName))->StartBackgroundTask();
+	}
+}
+
+void UFlareSaveGameSystem::CancelQueuedSave(const FString SaveName)
+{
+	SaveQueueLock.Lock();
+
+	// Also drop the data already taken by a running task
+	SaveGenerations.FindOrAdd(SaveName)++;
+
+	UFlareSaveGame* QueuedData = QueuedSaves.FindRef(SaveName);
+	if (QueuedData)
+	{
+		QueuedSaves.Remove(SaveName);
+		QueuedSaveTimes.Remove(SaveName);
+		QueuedSaveGenerations.Remove(SaveName);
+
+		SaveListLock.Lock();
+		SaveList.Remove(QueuedData);
+		SaveListLock.Unlock();
+
+		DEC_DWORD_STAT(STAT_FlareSave_QueueDepth);
+		INC_DWORD_STAT(STAT_FlareSave_DroppedSaves);
+	}
+
+	SaveQueueLock.Unlock();
+}
+
+void UFlareSaveGameSystem::ProcessSaveQueue(const FString SaveName)
+{
+	while (true)
+	{
+		SaveQueueLock.Lock();
+
+		UFlareSaveGame* SaveData = QueuedSaves.FindRef(SaveName);
+		double QueueTime = QueuedSaveTimes.FindRef(SaveName);
+		int32 Generation = QueuedSaveGenerations.FindRef(SaveName);
+		if (SaveData)
+		{
+			QueuedSaves.Remove(SaveName);
+			QueuedSaveTimes.Remove(SaveName);
+			QueuedSaveGenerations.Remove(SaveName);
+			DEC_DWORD_STAT(STAT_FlareSave_QueueDepth);
+		}
+		else
+		{
+			ProcessedSlots.Remove(SaveName);
+		}
+
+		SaveQueueLock.Unlock();
+
+		if (!SaveData)
+		{
+			break;
+		}
+
+		if (!WriteSave(SaveName, SaveData, Generation))
+		{
+			continue;
+		}
+
+		float Latency = 1000 * (FPlatformTime::Seconds() - QueueTime);
+		SET_FLOAT_STAT(STAT_FlareSave_WriteLatency, Latency);
+		FLOGCV(LogFlareSave, "UFlareSaveGameSystem::ProcessSaveQueue : %s written %.1fms after the request", *SaveName, Latency);
+	}
+}
+
 
 /*----------------------------------------------------
 	Getters
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "Object.h"
+#include "FlareSaveCache.h"
 #include "FlareSaveGameSystem.generated.h"
 
 class UFlareSaveGame;
@@ -31,8 +32,23 @@ public:
 	/* Keep Save data reference for the async save*/
 	virtual void PushSaveData(UFlareSaveGame* SaveData);
 
+	/** Save in the background, replacing the save data still waiting for this slot */
+	virtual void QueueSave(const FString SaveName, UFlareSaveGame* SaveData);
+
+	/** Drop the save data waiting for this slot */
+	virtual void CancelQueuedSave(const FString SaveName);
+
+	/** Write the save data queued for this slot until there is none left, from the background task */
+	void ProcessSaveQueue(const FString SaveName);
+
 protected:
 
+	/** Write a save, unless Generation is set and is no longer the current generation of the slot */
+	bool WriteSave(const FString SaveName, UFlareSaveGame* SaveData, int32 Generation);
+
+	/** Debug check : encode the save again without cached data, log any difference and keep the fresh text */
+	void CheckCachedSave(UFlareSaveGame* SaveData, FString& FileContents);
+
 
 	/*----------------------------------------------------
 		Protected data
@@ -40,11 +56,26 @@ protected:
 
 	FCriticalSection SaveLock;
 
+	// Serialized data reused between saves, protected by SaveLock
+	FFlareSaveCache CompanyCache;
+	FFlareSaveCache SectorCache;
+	FFlareSaveCache SpacecraftCache;
+
 	FCriticalSection SaveListLock;
 
 	UPROPERTY()
 	TArray<UFlareSaveGame *> SaveList;
 
+	// Background saves, protected by SaveQueueLock
+	FCriticalSection SaveQueueLock;
+	TMap<FString, UFlareSaveGame*> QueuedSaves;
+	TMap<FString, double> QueuedSaveTimes;
+	TMap<FString, int32> QueuedSaveGenerations;
+	TSet<FString> ProcessedSlots;
+
+	// Bumped by each queued, synchronous or deleted save, so that an older snapshot already taken by the task isn't written
+	TMap<FString, int32> SaveGenerations;
+
 
 public:
 
@@ -3,6 +3,10 @@
 #include "../FlareSaveGame.h"
 #include "FlareSaveReaderV1.h"
 #include "FlareSaveWriter.h"
+#include "Async/ParallelFor.h"
+#include "Base64.h"
+
+DECLARE_CYCLE_STAT(TEXT("FlareSaveReader LoadWorld"), STAT_FlareSaveReader_LoadWorld, STATGROUP_Flare);
 
 
 /*----------------------------------------------------
@@ -156,29 +160,31 @@ void UFlareSaveReaderV1::LoadCompanyDescription(const TSharedPtr<FJsonObject> Ob
 
 void UFlareSaveReaderV1::LoadWorld(const TSharedPtr<FJsonObject> Object, FFlareWorldSave* Data)
 {
+	SCOPE_CYCLE_COUNTER(STAT_FlareSaveReader_LoadWorld);
 	LoadInt64(Object, "Date", &Data->Date);
 
-	const TArray<TSharedPtr<FJsonValue>>* Companies;
-	if(Object->TryGetArrayField("Companies", Companies))
+	const TArray<TSharedPtr<FJsonValue>>* Companies = NULL;
+	const TArray<TSharedPtr<FJsonValue>>* Sectors = NULL;
+	Object->TryGetArrayField("Companies", Companies);
+	Object->TryGetArrayField("Sectors", Sectors);
+
+	// Companies and sectors are independent, decode them in parallel and keep their order
+	int32 CompanyCount = (Companies ? Companies->Num() : 0);
+	int32 SectorCount = (Sectors ? Sectors->Num() : 0);
+	Data->CompanyData.SetNum(CompanyCount);
+	Data->SectorData.SetNum(SectorCount);
+
+	ParallelFor(CompanyCount + SectorCount, [&](int32 Index)
 	{
-		for (TSharedPtr<FJsonValue> Item : *Companies)
+		if (Index < CompanyCount)
 		{
-			FFlareCompanySave ChildData;
-			LoadCompany(Item->AsObject(), &ChildData);
-			Data->CompanyData.Add(ChildData);
+			LoadCompany((*Companies)[Index]->AsObject(), &Data->CompanyData[Index]);
 		}
-	}
-
-	const TArray<TSharedPtr<FJsonValue>>* Sectors;
-	if(Object->TryGetArrayField("Sectors", Sectors))
-	{
-		for (TSharedPtr<FJsonValue> Item : *Sectors)
+		else
 		{
-			FFlareSectorSave ChildData;
-			LoadSector(Item->AsObject(), &ChildData);
-			Data->SectorData.Add(ChildData);
+			LoadSector((*Sectors)[Index - CompanyCount]->AsObject(), &Data->SectorData[Index - CompanyCount]);
 		}
-	}
+	});
 
 	const TArray<TSharedPtr<FJsonValue>>* Travels;
 	if(Object->TryGetArrayField("Travels", Travels))
@@ -973,7 +979,41 @@ void UFlareSaveReaderV1::LoadFloatBuffer(TSharedPtr< FJsonObject > Object, FStri
 		LoadInt32(*FloatBuffer, "MaxSize", &Data->MaxSize);
 		LoadInt32(*FloatBuffer, "WriteIndex", &Data->WriteIndex);
 
-		LoadFloatArray(*FloatBuffer, "Values", &Data->Values);
+		FString ValueString;
+		FString SampleString;
+		if((*FloatBuffer)->TryGetStringField("RawValues", ValueString))
+		{
+			TArray<uint8> ValueBytes;
+			FBase64::Decode(ValueString, ValueBytes);
+			Data->Values.SetNum(ValueBytes.Num() / sizeof(float));
+			FMemory::Memcpy(Data->Values.GetData(), ValueBytes.GetData(), Data->Values.Num() * sizeof(float));
+		}
+
+		// LEGACY : values saved as 16-bit samples between two bounds
+		else if((*FloatBuffer)->TryGetStringField("Samples", SampleString))
+		{
+			float MinValue = 0;
+			float MaxValue = 0;
+			LoadFloat(*FloatBuffer, "MinValue", &MinValue);
+			LoadFloat(*FloatBuffer, "MaxValue", &MaxValue);
+
+			TArray<uint8> SampleBytes;
+			FBase64::Decode(SampleString, SampleBytes);
+			const uint16* Samples = reinterpret_cast<const uint16*>(SampleBytes.GetData());
+			Data->Values.Empty();
+			for (int32 Index = 0; Index < SampleBytes.Num() / (int32) sizeof(uint16); Index++)
+			{
+				Data->Values.Add(MinValue + (MaxValue - MinValue) * Samples[Index] / MAX_uint16);
+			}
+		}
+
+		// LEGACY : values saved as an array of numbers
+		else
+		{
+			LoadFloatArray(*FloatBuffer, "Values", &Data->Values);
+		}
+
+		Data->UpdateSum();
 	}
 	else
 	{
@@ -2,6 +2,14 @@
 #include "../../Flare.h"
 #include "../FlareSaveGame.h"
 #include "FlareSaveWriter.h"
+#include "FlareSaveCache.h"
+#include "Async/ParallelFor.h"
+#include "Base64.h"
+
+DECLARE_CYCLE_STAT(TEXT("FlareSaveWriter SaveWorld"), STAT_FlareSaveWriter_SaveWorld, STATGROUP_Flare);
+
+typedef TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> FFlareSaveJsonWriter;
+typedef TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> FFlareSaveJsonWriterFactory;
 
 
 /*----------------------------------------------------
@@ -10,12 +18,26 @@
 
 UFlareSaveWriter::UFlareSaveWriter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, CurrentSave(NULL)
+	, CompanyCache(NULL)
+	, SectorCache(NULL)
+	, SpacecraftCache(NULL)
+{
+	// Unique per save, so that no saved string can be taken for a placeholder
+	FragmentPrefix = FString::Printf(TEXT("$%s:"), *FGuid::NewGuid().ToString());
+}
+
+void UFlareSaveWriter::SetCaches(FFlareSaveCache* Companies, FFlareSaveCache* Sectors, FFlareSaveCache* Spacecrafts)
 {
+	CompanyCache = Companies;
+	SectorCache = Sectors;
+	SpacecraftCache = Spacecrafts;
 }
 
 TSharedRef<FJsonObject> UFlareSaveWriter::SaveGame(UFlareSaveGame* Data)
 {
 	TSharedRef<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
+	CurrentSave = Data;
 
 	// General stuff
 	JsonObject->SetStringField("Game", "Helium Rain");
@@ -28,9 +50,141 @@ TSharedRef<FJsonObject> UFlareSaveWriter::SaveGame(UFlareSaveGame* Data)
 	JsonObject->SetStringField("CurrentIdentifierIndex", FormatInt32(Data->CurrentIdentifierIndex));
 	JsonObject->SetObjectField("World", SaveWorld(&Data->WorldData));
 
+	CurrentSave = NULL;
 	return JsonObject;
 }
 
+bool UFlareSaveWriter::SaveGameToString(UFlareSaveGame* Data, FString& FileContents)
+{
+	Fragments.Empty();
+	TSharedRef<FJsonObject> JsonObject = SaveGame(Data);
+
+	// Cached objects are placeholders in the tree, print it and insert their text
+	FString Contents;
+	TSharedRef<FFlareSaveJsonWriter> JsonWriter = FFlareSaveJsonWriterFactory::Create(&Contents);
+	if (!FJsonSerializer::Serialize(JsonObject, JsonWriter))
+	{
+		return false;
+	}
+	JsonWriter->Close();
+
+	ExpandFragments(Contents, FileContents);
+	Fragments.Empty();
+	return true;
+}
+
+
+/*----------------------------------------------------
+	Cache
+----------------------------------------------------*/
+
+TSharedRef<FJsonObject> UFlareSaveWriter::SaveCachedCompanyHeader(FFlareCompanySave* Data)
+{
+	if (!CompanyCache)
+	{
+		return SaveCompanyHeader(Data);
+	}
+
+	uint64 Revision = CurrentSave->CompanyRevisions.FindRef(Data->Identifier);
+	TSharedPtr<FJsonObject> JsonObject = CompanyCache->Find(Data->Identifier, Revision);
+
+	if (!JsonObject.IsValid())
+	{
+		JsonObject = SaveCompanyHeader(Data);
+		CompanyCache->Add(Data->Identifier, Revision, JsonObject);
+	}
+
+	return JsonObject.ToSharedRef();
+}
+
+TSharedRef<FJsonValue> UFlareSaveWriter::SaveCachedSpacecraft(FFlareSpacecraftSave* Data)
+{
+	if (!SpacecraftCache)
+	{
+		return MakeShareable(new FJsonValueObject(SaveSpacecraft(Data)));
+	}
+
+	uint64 Revision = CurrentSave->SpacecraftRevisions.FindRef(Data->Immatriculation);
+	TSharedPtr<FString> Text = SpacecraftCache->FindText(Data->Immatriculation, Revision);
+
+	if (!Text.IsValid())
+	{
+		Text = PrintFragment(SaveSpacecraft(Data));
+		SpacecraftCache->AddText(Data->Immatriculation, Revision, Text);
+	}
+
+	return AddFragment(Text);
+}
+
+TSharedRef<FJsonValue> UFlareSaveWriter::SaveCachedSector(FFlareSectorSave* Data)
+{
+	if (!SectorCache)
+	{
+		return MakeShareable(new FJsonValueObject(SaveSector(Data)));
+	}
+
+	uint64 Revision = CurrentSave->SectorRevisions.FindRef(Data->Identifier);
+	TSharedPtr<FString> Text = SectorCache->FindText(Data->Identifier, Revision);
+
+	if (!Text.IsValid())
+	{
+		Text = PrintFragment(SaveSector(Data));
+		SectorCache->AddText(Data->Identifier, Revision, Text);
+	}
+
+	return AddFragment(Text);
+}
+
+TSharedPtr<FString> UFlareSaveWriter::PrintFragment(TSharedRef<FJsonObject> JsonObject)
+{
+	TSharedPtr<FString> Text = MakeShareable(new FString());
+	TSharedRef<FFlareSaveJsonWriter> JsonWriter = FFlareSaveJsonWriterFactory::Create(Text.Get());
+	FJsonSerializer::Serialize(JsonObject, JsonWriter);
+	JsonWriter->Close();
+	return Text;
+}
+
+TSharedRef<FJsonValue> UFlareSaveWriter::AddFragment(TSharedPtr<FString> Text)
+{
+	FScopeLock Lock(&FragmentsLock);
+	int32 FragmentIndex = Fragments.Add(Text);
+	return MakeShareable(new FJsonValueString(FragmentPrefix + FString::FromInt(FragmentIndex)));
+}
+
+void UFlareSaveWriter::ExpandFragments(const FString& Contents, FString& FileContents)
+{
+	int32 FileLength = Contents.Len();
+	for (int32 Index = 0; Index < Fragments.Num(); Index++)
+	{
+		FileLength += Fragments[Index]->Len();
+	}
+
+	FileContents.Empty(FileLength);
+	FString Placeholder = TEXT("\"") + FragmentPrefix;
+	int32 CopyStart = 0;
+
+	while (true)
+	{
+		int32 PlaceholderStart = Contents.Find(Placeholder, ESearchCase::CaseSensitive, ESearchDir::FromStart, CopyStart);
+		if (PlaceholderStart == INDEX_NONE)
+		{
+			break;
+		}
+
+		// The placeholder is the quoted prefix followed by the fragment index
+		int32 IndexStart = PlaceholderStart + Placeholder.Len();
+		int32 IndexEnd = Contents.Find(TEXT("\""), ESearchCase::CaseSensitive, ESearchDir::FromStart, IndexStart);
+		int32 FragmentIndex = FCString::Atoi(*Contents.Mid(IndexStart, IndexEnd - IndexStart));
+		FCHECK(Fragments.IsValidIndex(FragmentIndex));
+
+		FileContents += Contents.Mid(CopyStart, PlaceholderStart - CopyStart);
+		FileContents += *Fragments[FragmentIndex];
+		CopyStart = IndexEnd + 1;
+	}
+
+	FileContents += Contents.Mid(CopyStart);
+}
+
 /*----------------------------------------------------
 	Generator
 ----------------------------------------------------*/
@@ -141,22 +295,35 @@ TSharedRef<FJsonObject> UFlareSaveWriter::SaveCompanyDescription(FFlareCompanyDe
 
 TSharedRef<FJsonObject> UFlareSaveWriter::SaveWorld(FFlareWorldSave* Data)
 {
+	SCOPE_CYCLE_COUNTER(STAT_FlareSaveWriter_SaveWorld);
 	TSharedRef<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
 
 	JsonObject->SetStringField("Date", FormatInt64(Data->Date));
 
-	TArray< TSharedPtr<FJsonValue> > Companies;
-	for(int i = 0; i < Data->CompanyData.Num(); i++)
+	// Companies and sectors are independent, serialize them in parallel and keep their order
+	int32 CompanyCount = Data->CompanyData.Num();
+	int32 SectorCount = Data->SectorData.Num();
+	TArray< TSharedPtr<FJsonValue> > Subtrees;
+	Subtrees.SetNum(CompanyCount + SectorCount);
+
+	ParallelFor(Subtrees.Num(), [&](int32 Index)
 	{
-		Companies.Add(MakeShareable(new FJsonValueObject(SaveCompany(&Data->CompanyData[i]))));
-	}
+		if (Index < CompanyCount)
+		{
+			Subtrees[Index] = MakeShareable(new FJsonValueObject(SaveCompany(&Data->CompanyData[Index])));
+		}
+		else
+		{
+			Subtrees[Index] = SaveCachedSector(&Data->SectorData[Index - CompanyCount]);
+		}
+	});
+
+	TArray< TSharedPtr<FJsonValue> > Companies;
+	Companies.Append(Subtrees.GetData(), CompanyCount);
 	JsonObject->SetArrayField("Companies", Companies);
 
 	TArray< TSharedPtr<FJsonValue> > Sectors;
-	for(int i = 0; i < Data->SectorData.Num(); i++)
-	{
-		Sectors.Add(MakeShareable(new FJsonValueObject(SaveSector(&Data->SectorData[i]))));
-	}
+	Sectors.Append(Subtrees.GetData() + CompanyCount, SectorCount);
 	JsonObject->SetArrayField("Sectors", Sectors);
 
 	TArray< TSharedPtr<FJsonValue> > Travels;
@@ -174,6 +341,51 @@ TSharedRef<FJsonObject> UFlareSaveWriter::SaveWorld(FFlareWorldSave* Data)
 
 
 TSharedRef<FJsonObject> UFlareSaveWriter::SaveCompany(FFlareCompanySave* Data)
+{
+	TSharedRef<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
+	TSharedRef<FJsonObject> Header = SaveCachedCompanyHeader(Data);
+
+	for (auto& Field : Header->Values)
+	{
+		// Spacecrafts, fleets and trade routes are stored before the company knowledge
+		if (Field.Key == "SectorsKnowledge")
+		{
+			TArray< TSharedPtr<FJsonValue> > Ships;
+			for(int i = 0; i < Data->ShipData.Num(); i++)
+			{
+				Ships.Add(SaveCachedSpacecraft(&Data->ShipData[i]));
+			}
+			JsonObject->SetArrayField("Ships", Ships);
+
+			TArray< TSharedPtr<FJsonValue> > Stations;
+			for(int i = 0; i < Data->StationData.Num(); i++)
+			{
+				Stations.Add(SaveCachedSpacecraft(&Data->StationData[i]));
+			}
+			JsonObject->SetArrayField("Stations", Stations);
+
+			TArray< TSharedPtr<FJsonValue> > Fleets;
+			for(int i = 0; i < Data->Fleets.Num(); i++)
+			{
+				Fleets.Add(MakeShareable(new FJsonValueObject(SaveFleet(&Data->Fleets[i]))));
+			}
+			JsonObject->SetArrayField("Fleets", Fleets);
+
+			TArray< TSharedPtr<FJsonValue> > TradeRoutes;
+			for(int i = 0; i < Data->TradeRoutes.Num(); i++)
+			{
+				TradeRoutes.Add(MakeShareable(new FJsonValueObject(SaveTradeRoute(&Data->TradeRoutes[i]))));
+			}
+			JsonObject->SetArrayField("TradeRoutes", TradeRoutes);
+		}
+
+		JsonObject->SetField(Field.Key, Field.Value);
+	}
+
+	return JsonObject;
+}
+
+TSharedRef<FJsonObject> UFlareSaveWriter::SaveCompanyHeader(FFlareCompanySave* Data)
 {
 	TSharedRef<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
 
@@ -192,35 +404,6 @@ TSharedRef<FJsonObject> UFlareSaveWriter::SaveCompany(FFlareCompanySave* Data)
 	}
 	JsonObject->SetArrayField("HostileCompanies", HostileCompanies);
 
-	TArray< TSharedPtr<FJsonValue> > Ships;
-	for(int i = 0; i < Data->ShipData.Num(); i++)
-	{
-		Ships.Add(MakeShareable(new FJsonValueObject(SaveSpacecraft(&Data->ShipData[i]))));
-	}
-	JsonObject->SetArrayField("Ships", Ships);
-
-	TArray< TSharedPtr<FJsonValue> > Stations;
-	for(int i = 0; i < Data->StationData.Num(); i++)
-	{
-		Stations.Add(MakeShareable(new FJsonValueObject(SaveSpacecraft(&Data->StationData[i]))));
-	}
-	JsonObject->SetArrayField("Stations", Stations);
-
-	TArray< TSharedPtr<FJsonValue> > Fleets;
-	for(int i = 0; i < Data->Fleets.Num(); i++)
-	{
-		Fleets.Add(MakeShareable(new FJsonValueObject(SaveFleet(&Data->Fleets[i]))));
-	}
-	JsonObject->SetArrayField("Fleets", Fleets);
-
-	TArray< TSharedPtr<FJsonValue> > TradeRoutes;
-	for(int i = 0; i < Data->TradeRoutes.Num(); i++)
-	{
-		TradeRoutes.Add(MakeShareable(new FJsonValueObject(SaveTradeRoute(&Data->TradeRoutes[i]))));
-	}
-	JsonObject->SetArrayField("TradeRoutes", TradeRoutes);
-
-
 	TArray< TSharedPtr<FJsonValue> > SectorsKnowledge;
 	for(int i = 0; i < Data->SectorsKnowledge.Num(); i++)
 	{
@@ -678,14 +861,10 @@ TSharedRef<FJsonObject> UFlareSaveWriter::SaveFloatBuffer(FFlareFloatBuffer* Dat
 	JsonObject->SetStringField("MaxSize", FormatInt32(Data->MaxSize));
 	JsonObject->SetStringField("WriteIndex", FormatInt32(Data->WriteIndex));
 
-
-
-	TArray< TSharedPtr<FJsonValue> > Values;
-	for(int i = 0; i < Data->Values.Num(); i++)
-	{
-		Values.Add(MakeShareable(new FJsonValueNumber(Data->Values[i])));
-	}
-	JsonObject->SetArrayField("Values", Values);
+	// Values are written exactly, as a single string rather than an array of numbers
+	TArray<uint8> ValueBytes;
+	ValueBytes.Append(reinterpret_cast<const uint8*>(Data->Values.GetData()), Data->Values.Num() * sizeof(float));
+	JsonObject->SetStringField("RawValues", FBase64::Encode(ValueBytes));
 
 	return JsonObject;
 }
@@ -41,6 +41,8 @@ struct FFFlareResourcePrice;
 struct FFlareTravelSave;
 struct FFlareFloatBuffer;
 
+class FFlareSaveCache;
+
 
 UCLASS()
 class HELIUMRAIN_API UFlareSaveWriter: public UObject
@@ -49,9 +51,39 @@ class HELIUMRAIN_API UFlareSaveWriter: public UObject
 
 public:
 
+	/** Reuse the serialized data of unchanged objects from these caches, that must stay locked during the save */
+	void SetCaches(FFlareSaveCache* Companies, FFlareSaveCache* Sectors, FFlareSaveCache* Spacecrafts);
+
 	TSharedRef<FJsonObject> SaveGame(UFlareSaveGame* Data);
 
+	/** Save the game to JSON text, splicing in the cached text of unchanged objects */
+	bool SaveGameToString(UFlareSaveGame* Data, FString& FileContents);
+
 protected:
+
+	/*----------------------------------------------------
+	  Cache
+	----------------------------------------------------*/
+
+	/** Get the company fields that don't depend on other objects, from the cache if possible */
+	TSharedRef<FJsonObject> SaveCachedCompanyHeader(FFlareCompanySave* Data);
+
+	/** Get a spacecraft from the cache if possible */
+	TSharedRef<FJsonValue> SaveCachedSpacecraft(FFlareSpacecraftSave* Data);
+
+	/** Get a sector from the cache if possible */
+	TSharedRef<FJsonValue> SaveCachedSector(FFlareSectorSave* Data);
+
+	/** Print an object to JSON text, as it will appear in the save */
+	static TSharedPtr<FString> PrintFragment(TSharedRef<FJsonObject> JsonObject);
+
+	/** Get a placeholder value that SaveGameToString will replace with this text */
+	TSharedRef<FJsonValue> AddFragment(TSharedPtr<FString> Text);
+
+	/** Replace the fragment placeholders with their text */
+	void ExpandFragments(const FString& Contents, FString& FileContents);
+
+
 	/*----------------------------------------------------
 	  Generator
 	----------------------------------------------------*/
@@ -66,6 +98,7 @@ protected:
 
 
 	TSharedRef<FJsonObject> SaveCompany(FFlareCompanySave* Data);
+	TSharedRef<FJsonObject> SaveCompanyHeader(FFlareCompanySave* Data);
 
 	TSharedRef<FJsonObject> SaveSpacecraft(FFlareSpacecraftSave* Data);
 	TSharedRef<FJsonObject> SavePilot(FFlareShipPilotSave* Data);
@@ -102,6 +135,15 @@ protected:
 		Protected data
 	----------------------------------------------------*/
 
+	UFlareSaveGame*                                 CurrentSave;
+	FFlareSaveCache*                                CompanyCache;
+	FFlareSaveCache*                                SectorCache;
+	FFlareSaveCache*                                SpacecraftCache;
+
+	// Text of cached objects, referenced by placeholders in the JSON tree
+	FCriticalSection                                FragmentsLock;
+	TArray<TSharedPtr<FString>>                     Fragments;
+	FString                                         FragmentPrefix;
 
 
 public:
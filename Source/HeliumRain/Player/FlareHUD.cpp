@@ -114,6 +114,15 @@ AFlareHUD::AFlareHUD(const class FObjectInitializer& PCIP)
 
 	// Debug
 	DistortionGrid = 0;
+
+	// Caches
+	ProjectionValid = false;
+	DistortionTableSubdivisions = 0;
+	DistortionTableWidth = 0;
+	DistortionTableExtraHeight = 0;
+	DistortionTableMilitary = false;
+	DistortionTableDirty = true;
+	HostilityColorsVersion = 0;
 }
 
 void AFlareHUD::BeginPlay()
@@ -323,6 +332,7 @@ void AFlareHUD::DrawCockpitHUD(UCanvas* TargetCanvas, int32 Width, int32 Height)
 		CurrentCanvas = TargetCanvas;
 		IsDrawingCockpit = true;
 		IsDrawingHUD = true;
+		UpdateDistortionTable();
 
 		if (HUDVisible && ShouldDrawHUD())
 		{
@@ -833,6 +843,7 @@ void AFlareHUD::DrawHUDInternal()
 	UFlareSector* ActiveSector = PC->GetGame()->GetActiveSector();
 	bool IsExternalCamera = PlayerShip->GetStateManager()->IsExternalCamera();
 	EFlareWeaponGroupType::Type WeaponType = PlayerShip->GetWeaponsSystem()->GetActiveWeaponType();
+	UpdateProjection();
 
 	// Draw nose
 	if (HUDVisible && !IsExternalCamera)
@@ -884,21 +895,21 @@ void AFlareHUD::DrawHUDInternal()
 	// Iterate on all 'other' ships to show designators, markings, etc
 	ScreenTargets.Empty();
 	ScreenTargetsOwner = PlayerShip->GetParent()->GetImmatriculation();
-	for (int SpacecraftIndex = 0; SpacecraftIndex < ActiveSector->GetSpacecrafts().Num(); SpacecraftIndex ++)
+	ProjectHUDTargets(PlayerShip);
+	for (int TargetIndex = 0; TargetIndex < HUDTargets.Num(); TargetIndex ++)
 	{
-		AFlareSpacecraft* Spacecraft = ActiveSector->GetSpacecrafts()[SpacecraftIndex];
-		if (Spacecraft != PlayerShip)
-		{
-			// Draw designators
-			bool ShouldDrawSearchMarker = DrawHUDDesignator(Spacecraft);
-			DrawDockingHelper(Spacecraft);
+		const FFlareHUDTarget& Target = HUDTargets[TargetIndex];
+		AFlareSpacecraft* Spacecraft = Target.Spacecraft;
 
-			// Draw search markers
-			if (!IsExternalCamera && ShouldDrawSearchMarker)
-			{
-				bool Highlighted = (PlayerShip && Spacecraft == PlayerShip->GetCurrentTarget());
-				DrawSearchArrow(Spacecraft->GetActorLocation(), GetHostilityColor(PC, Spacecraft), Highlighted, FocusDistance);
-			}
+		// Draw designators
+		bool ShouldDrawSearchMarker = DrawHUDDesignator(Target);
+		DrawDockingHelper(Spacecraft);
+
+		// Draw search markers
+		if (!IsExternalCamera && ShouldDrawSearchMarker)
+		{
+			bool Highlighted = (PlayerShip && Spacecraft == PlayerShip->GetCurrentTarget());
+			DrawSearchArrow(Spacecraft->GetActorLocation(), GetHostilityColor(PC, Spacecraft), Highlighted, FocusDistance);
 		}
 	}
 
@@ -1049,6 +1060,37 @@ void AFlareHUD::DrawHUDInternal()
 
 	// Sort screen targets
 	ScreenTargets.Sort(&IsCloserToCenter);
+	ProjectionValid = false;
+}
+
+void AFlareHUD::ProjectHUDTargets(AFlareSpacecraft* PlayerShip)
+{
+	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
+	UFlareSector* ActiveSector = PC->GetGame()->GetActiveSector();
+	FVector PlayerLocation = PlayerShip->GetActorLocation();
+
+	HUDTargets.Reset();
+	for (int SpacecraftIndex = 0; SpacecraftIndex < ActiveSector->GetSpacecrafts().Num(); SpacecraftIndex ++)
+	{
+		AFlareSpacecraft* Spacecraft = ActiveSector->GetSpacecrafts()[SpacecraftIndex];
+		if (Spacecraft == PlayerShip)
+		{
+			continue;
+		}
+
+		FFlareHUDTarget Target;
+		Target.Spacecraft = Spacecraft;
+		Target.Distance = (Spacecraft->GetActorLocation() - PlayerLocation).Size();
+		Target.Projected = ProjectWorldLocationToCockpit(Spacecraft->GetActorLocation(), Target.ScreenPosition);
+
+		// Not on screen and too far for a search arrow or a docking helper : nothing to draw
+		if (!Target.Projected && Target.Distance >= FocusDistance)
+		{
+			continue;
+		}
+
+		HUDTargets.Add(Target);
+	}
 }
 
 void AFlareHUD::DrawDebugGrid(FLinearColor Color)
@@ -1148,19 +1190,18 @@ void AFlareHUD::DrawSearchArrow(FVector TargetLocation, FLinearColor Color, bool
 	}
 }
 
-bool AFlareHUD::DrawHUDDesignator(AFlareSpacecraft* Spacecraft)
+bool AFlareHUD::DrawHUDDesignator(const FFlareHUDTarget& Target)
 {
 	// Calculation data
-	FVector2D ScreenPosition;
+	AFlareSpacecraft* Spacecraft = Target.Spacecraft;
+	FVector2D ScreenPosition = Target.ScreenPosition;
 	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
-	FVector PlayerLocation = PC->GetShipPawn()->GetActorLocation();
-	FVector TargetLocation = Spacecraft->GetActorLocation();
 
-	if (ProjectWorldLocationToCockpit(TargetLocation, ScreenPosition) && Spacecraft != ContextMenuSpacecraft)
+	if (Target.Projected && Spacecraft != ContextMenuSpacecraft)
 	{
 		// Compute apparent size in screenspace
 		float ShipSize = 2 * Spacecraft->GetMeshScale();
-		float Distance = (TargetLocation - PlayerLocation).Size();
+		float Distance = Target.Distance;
 		float ApparentAngle = FMath::RadiansToDegrees(FMath::Atan(ShipSize / Distance));
 		float Size = (ApparentAngle / PC->PlayerCameraManager->GetFOVAngle()) * CurrentViewportSize.X;
 		FVector2D ObjectSize = FMath::Min(0.66f * Size, 300.0f) * FVector2D(1, 1);
@@ -1177,10 +1218,19 @@ bool AFlareHUD::DrawHUDDesignator(AFlareSpacecraft* Spacecraft)
 			float CornerSize = 8;
 			AFlareSpacecraft* PlayerShip = PC->GetShipPawn();
 			FVector2D CenterPos = ScreenPosition - ObjectSize / 2;
-			FLinearColor Color = GetHostilityColor(PC, Spacecraft);
+			bool Highlighted = (PlayerShip && Spacecraft == PlayerShip->GetCurrentTarget());
+
+			// Designators out of the viewport are not drawn, only the search marker
+			FVector2D Margin = ObjectSize / 2 + 2 * IconSize * FVector2D::UnitVector;
+			if (!Highlighted
+			 && (ScreenPosition.X < -Margin.X || ScreenPosition.X > CurrentViewportSize.X + Margin.X
+			  || ScreenPosition.Y < -Margin.Y || ScreenPosition.Y > CurrentViewportSize.Y + Margin.Y))
+			{
+				return true;
+			}
 
 			// Draw designator corners
-			bool Highlighted = (PlayerShip && Spacecraft == PlayerShip->GetCurrentTarget());
+			FLinearColor Color = GetHostilityColor(PC, Spacecraft);
 			bool Dangerous = PilotHelper::IsShipDangerous(Spacecraft);
 			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, -1), 0,     Color, Dangerous, Highlighted);
 			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, +1), -90,   Color, Dangerous, Highlighted);
@@ -1550,19 +1600,60 @@ bool AFlareHUD::IsInScreen(FVector2D ScreenPosition) const
 
 FLinearColor AFlareHUD::GetHostilityColor(AFlarePlayerController* PC, AFlareSpacecraft* Target)
 {
-	EFlareHostility::Type Hostility = Target->GetParent()->GetPlayerWarState();
+	// Relations changed, or a new game was loaded
+	UFlareWorld* World = PC->GetGame()->GetGameWorld();
+	if (HostilityColorsWorld.Get() != World || HostilityColorsVersion != World->GetHostilityVersion())
+	{
+		HostilityColors.Reset();
+		HostilityColorsWorld = World;
+		HostilityColorsVersion = World->GetHostilityVersion();
+	}
+
+	UFlareCompany* Company = Target->GetParent()->GetCompany();
+	FLinearColor* CachedColor = HostilityColors.Find(Company);
+	if (CachedColor)
+	{
+		return *CachedColor;
+	}
+
+	FLinearColor Color;
+	EFlareHostility::Type Hostility = Company->GetPlayerWarState();
 	switch (Hostility)
 	{
 		case EFlareHostility::Hostile:
-			return HudColorEnemy;
+			Color = HudColorEnemy;
+			break;
 
 		case EFlareHostility::Owned:
-			return HudColorFriendly;
+			Color = HudColorFriendly;
+			break;
 
 		case EFlareHostility::Neutral:
 		case EFlareHostility::Friendly:
 		default:
-			return HudColorNeutral;
+			Color = HudColorNeutral;
+			break;
+	}
+
+	HostilityColors.Add(Company, Color);
+	return Color;
+}
+
+void AFlareHUD::UpdateProjection()
+{
+	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
+	ULocalPlayer* LocalPlayer = PC->GetLocalPlayer();
+	ProjectionValid = false;
+
+	if (LocalPlayer && LocalPlayer->ViewportClient)
+	{
+		FSceneViewProjectionData ProjectionData;
+		if (LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, eSSP_FULL, ProjectionData))
+		{
+			ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+			ViewRect = ProjectionData.GetConstrainedViewRect();
+			ProjectionValid = true;
+		}
 	}
 }
 
@@ -1570,8 +1661,19 @@ bool AFlareHUD::ProjectWorldLocationToCockpit(FVector World, FVector2D& Cockpit)
 {
 	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
 
+	// Use the projection of the current HUD pass if any
 	FVector2D Screen;
-	if (PC->ProjectWorldLocationToScreen(World, Screen))
+	bool Projected;
+	if (ProjectionValid)
+	{
+		Projected = FSceneView::ProjectWorldToScreen(World, ViewRect, ViewProjectionMatrix, Screen);
+	}
+	else
+	{
+		Projected = PC->ProjectWorldLocationToScreen(World, Screen);
+	}
+
+	if (Projected)
 	{
 		if (IsDrawingCockpit)
 		{
@@ -1598,6 +1700,9 @@ bool AFlareHUD::ProjectWorldLocationToCockpit(FVector World, FVector2D& Cockpit)
 #define GRID_H_SIZE 11
 #define GRID_V_SIZE 11
 
+#define DISTORTION_TABLE_STEP 8 // Pixels between baked samples
+#define DISTORTION_TABLE_MAX_SUBDIVISIONS 64
+
 static float FighterHorizontalDistortionMap[] = {
 	1.000f, 0.820f, 0.850f, 0.915f, 1.000f, 1.000f, 1.000f, 1.040f, 1.038f, 1.023f, 1.000f,
 	1.000f, 0.790f, 0.840f, 0.905f, 1.000f, 1.000f, 1.000f, 1.042f, 1.040f, 1.024f, 1.000f,
@@ -1687,25 +1792,60 @@ void AFlareHUD::SetDistortion(uint32 Axis, uint32 X, uint32 Y, float Value)
 		{
 			GetCurrentVerticalGrid()[X + Y * GRID_V_SIZE] = Value;
 		}
+
+		DistortionTableDirty = true;
 	}
 }
 
 bool AFlareHUD::ScreenToCockpit(FVector2D Screen, FVector2D& Cockpit)
 {
-	float AspectRatio = CurrentViewportSize.X/CurrentViewportSize.Y;
-	float ExtraHeight = ViewportSize.Y - ViewportSize.X / AspectRatio;
+	if (DistortionTable.Num() == 0)
+	{
+		UpdateDistortionTable();
+	}
 
 	// Find for near point of the map
 	float XRelativeLocation = (Screen.X / ViewportSize.X)  * (GRID_H_SIZE - 1);
-	float YRelativeLocation = (Screen.Y - (ExtraHeight / 2)) / (ViewportSize.Y - ExtraHeight) * (GRID_V_SIZE - 1);
-	
-	//FLOGV("Screen=%s XRelativeLocation=%f YRelativeLocation=%f AspectRatio=%f ExtraHeight=%f", *Screen.ToString(), XRelativeLocation, YRelativeLocation, AspectRatio, ExtraHeight);
+	float YRelativeLocation = (Screen.Y - (DistortionTableExtraHeight / 2)) / (ViewportSize.Y - DistortionTableExtraHeight) * (GRID_V_SIZE - 1);
+
+	//FLOGV("Screen=%s XRelativeLocation=%f YRelativeLocation=%f", *Screen.ToString(), XRelativeLocation, YRelativeLocation);
 
 	if(XRelativeLocation < 0.f || XRelativeLocation > (GRID_H_SIZE - 1) || YRelativeLocation < 0.f || YRelativeLocation > (GRID_V_SIZE - 1))
 	{
 		return false;
 	}
 
+	// Interpolate between the four nearest baked positions
+	float TableX = XRelativeLocation * DistortionTableSubdivisions;
+	float TableY = YRelativeLocation * DistortionTableSubdivisions;
+	int32 Left = FMath::Min(FMath::FloorToInt(TableX), DistortionTableWidth - 2);
+	int32 Top = FMath::Min(FMath::FloorToInt(TableY), DistortionTableWidth - 2);
+	float LocalX = TableX - Left;
+	float LocalY = TableY - Top;
+
+	const FVector2D* TopRow = &DistortionTable[Left + Top * DistortionTableWidth];
+	const FVector2D* BottomRow = TopRow + DistortionTableWidth;
+	FVector2D TopCockpit = FMath::Lerp(TopRow[0], TopRow[1], LocalX);
+	FVector2D BottomCockpit = FMath::Lerp(BottomRow[0], BottomRow[1], LocalX);
+	Cockpit = FMath::Lerp(TopCockpit, BottomCockpit, LocalY);
+
+	//FLOGV("Cockpit=%s", *Cockpit.ToString());
+	
+	if (Cockpit.X < 0.f || Cockpit.X > CurrentViewportSize.X || Cockpit.Y < 0.f || Cockpit.Y > CurrentViewportSize.Y)
+	{
+		return false;
+	}
+	else
+	{
+		return true;
+	}
+}
+
+FVector2D AFlareHUD::GetDistortion(float XRelativeLocation, float YRelativeLocation) const
+{
+	const float* HorizontalGrid = GetCurrentHorizontalGrid();
+	const float* VerticalGrid = GetCurrentVerticalGrid();
+
 	int32 LeftIndex = FMath::FloorToInt(XRelativeLocation);
 	int32 RightIndex = FMath::CeilToInt(XRelativeLocation);
 	int32 TopIndex = FMath::FloorToInt(YRelativeLocation);
@@ -1714,37 +1854,69 @@ bool AFlareHUD::ScreenToCockpit(FVector2D Screen, FVector2D& Cockpit)
 	float LocalX = XRelativeLocation - LeftIndex;
 	float LocalY = YRelativeLocation - TopIndex;
 	
-	float TopLeftXDistorsion = GetCurrentHorizontalGrid()[LeftIndex + TopIndex * GRID_H_SIZE];
-	float TopRightXDistorsion = GetCurrentHorizontalGrid()[RightIndex + TopIndex * GRID_H_SIZE];
-	float BottomLeftXDistorsion = GetCurrentHorizontalGrid()[LeftIndex + BottomIndex * GRID_H_SIZE];
-	float BottomRightXDistorsion = GetCurrentHorizontalGrid()[RightIndex + BottomIndex * GRID_H_SIZE];
+	float TopLeftXDistorsion = HorizontalGrid[LeftIndex + TopIndex * GRID_H_SIZE];
+	float TopRightXDistorsion = HorizontalGrid[RightIndex + TopIndex * GRID_H_SIZE];
+	float BottomLeftXDistorsion = HorizontalGrid[LeftIndex + BottomIndex * GRID_H_SIZE];
+	float BottomRightXDistorsion = HorizontalGrid[RightIndex + BottomIndex * GRID_H_SIZE];
 	
 	float TopMeanXDistorsion = LocalX * TopRightXDistorsion +  (1 - LocalX) * TopLeftXDistorsion;
 	float BottomMeanXDistorsion = LocalX * BottomRightXDistorsion +  (1 - LocalX) * BottomLeftXDistorsion;
 	float MeanXDistorsion = LocalY * BottomMeanXDistorsion +  (1 - LocalY) * TopMeanXDistorsion;
 
-	float TopLeftYDistorsion = GetCurrentVerticalGrid()[LeftIndex + TopIndex * GRID_V_SIZE];
-	float TopRightYDistorsion = GetCurrentVerticalGrid()[RightIndex + TopIndex * GRID_V_SIZE];
-	float BottomLeftYDistorsion = GetCurrentVerticalGrid()[LeftIndex + BottomIndex * GRID_V_SIZE];
-	float BottomRightYDistorsion = GetCurrentVerticalGrid()[RightIndex + BottomIndex * GRID_V_SIZE];
+	float TopLeftYDistorsion = VerticalGrid[LeftIndex + TopIndex * GRID_V_SIZE];
+	float TopRightYDistorsion = VerticalGrid[RightIndex + TopIndex * GRID_V_SIZE];
+	float BottomLeftYDistorsion = VerticalGrid[LeftIndex + BottomIndex * GRID_V_SIZE];
+	float BottomRightYDistorsion = VerticalGrid[RightIndex + BottomIndex * GRID_V_SIZE];
 	
 	float TopMeanYDistorsion = LocalX * TopRightYDistorsion +  (1 - LocalX) * TopLeftYDistorsion;
 	float BottomMeanYDistorsion = LocalX * BottomRightYDistorsion +  (1 - LocalX) * BottomLeftYDistorsion;
 	float MeanYDistorsion = LocalY * BottomMeanYDistorsion +  (1 - LocalY) * TopMeanYDistorsion;
-	
-	Cockpit = FVector2D(XRelativeLocation / (GRID_H_SIZE - 1) * MeanXDistorsion * CurrentViewportSize.X,
-						YRelativeLocation / (GRID_H_SIZE - 1) * MeanYDistorsion * CurrentViewportSize.Y);
 
-	//FLOGV("Cockpit=%s MeanXDistorsion=%f MeanYDistorsion=%f", *Cockpit.ToString(), MeanXDistorsion, MeanYDistorsion);
-	
-	if (Cockpit.X < 0.f || Cockpit.X > CurrentViewportSize.X || Cockpit.Y < 0.f || Cockpit.Y > CurrentViewportSize.Y)
+	return FVector2D(MeanXDistorsion, MeanYDistorsion);
+}
+
+void AFlareHUD::UpdateDistortionTable()
+{
+	bool Military = IsFlyingMilitaryShip();
+
+	if (!DistortionTableDirty
+	 && DistortionTable.Num() > 0
+	 && DistortionTableMilitary == Military
+	 && DistortionTableScreenSize == ViewportSize
+	 && DistortionTableCockpitSize == CurrentViewportSize)
 	{
-		return false;
+		return;
 	}
-	else
+
+	DistortionTableDirty = false;
+	DistortionTableMilitary = Military;
+	DistortionTableScreenSize = ViewportSize;
+	DistortionTableCockpitSize = CurrentViewportSize;
+
+	float AspectRatio = CurrentViewportSize.X / CurrentViewportSize.Y;
+	DistortionTableExtraHeight = ViewportSize.Y - ViewportSize.X / AspectRatio;
+
+	// One sample every few screen pixels
+	float CellSize = FMath::Max(ViewportSize.X, ViewportSize.Y) / (GRID_H_SIZE - 1);
+	DistortionTableSubdivisions = FMath::Clamp(FMath::CeilToInt(CellSize / DISTORTION_TABLE_STEP), 1, DISTORTION_TABLE_MAX_SUBDIVISIONS);
+	DistortionTableWidth = (GRID_H_SIZE - 1) * DistortionTableSubdivisions + 1;
+	DistortionTable.SetNum(DistortionTableWidth * DistortionTableWidth);
+
+	for (int32 Y = 0; Y < DistortionTableWidth; Y++)
 	{
-		return true;
+		for (int32 X = 0; X < DistortionTableWidth; X++)
+		{
+			float XRelativeLocation = (float) X / DistortionTableSubdivisions;
+			float YRelativeLocation = (float) Y / DistortionTableSubdivisions;
+			FVector2D Distortion = GetDistortion(XRelativeLocation, YRelativeLocation);
+
+			DistortionTable[X + Y * DistortionTableWidth] = FVector2D(
+				XRelativeLocation / (GRID_H_SIZE - 1) * Distortion.X * CurrentViewportSize.X,
+				YRelativeLocation / (GRID_H_SIZE - 1) * Distortion.Y * CurrentViewportSize.Y);
+		}
 	}
+
+	FLOGV("AFlareHUD::UpdateDistortionTable : %dx%d samples for %s", DistortionTableWidth, DistortionTableWidth, *ViewportSize.ToString());
 }
 
 
@@ -10,6 +10,8 @@
 class SFlareHUDMenu;
 class SFlareMouseMenu;
 class UFlareWeapon;
+class UFlareCompany;
+class UFlareWorld;
 
 
 /** Target info */
@@ -25,6 +27,20 @@ struct FFlareScreenTarget
 };
 
 
+/** Spacecraft projected for designators, once per HUD pass */
+struct FFlareHUDTarget
+{
+	AFlareSpacecraft*      Spacecraft;
+
+	FVector2D              ScreenPosition;
+
+	float                  Distance;
+
+	bool                   Projected;
+
+};
+
+
 /** Navigation HUD */
 UCLASS()
 class HELIUMRAIN_API AFlareHUD : public AHUD
@@ -156,8 +172,11 @@ protected:
 	/** Draw a search arrow */
 	void DrawSearchArrow(FVector TargetLocation, FLinearColor Color, bool Highlighted, float MaxDistance = 10000000);
 
+	/** Project all spacecrafts at once, and cull those that won't be drawn */
+	void ProjectHUDTargets(AFlareSpacecraft* PlayerShip);
+
 	/** Draw a designator block around a spacecraft */
-	bool DrawHUDDesignator(AFlareSpacecraft* Spacecraft);
+	bool DrawHUDDesignator(const FFlareHUDTarget& Target);
 
 	/** Draw a designator corner */
 	void DrawHUDDesignatorCorner(FVector2D Position, FVector2D ObjectSize, float IconSize, FVector2D MainOffset, float Rotation, FLinearColor HudColor, bool Dangerous, bool Highlighted);
@@ -201,12 +220,21 @@ protected:
 	/** Get the distortion grid */
 	float* GetCurrentVerticalGrid() const;
 	
+	/** Store the view projection of the player for the current HUD pass */
+	void UpdateProjection();
+
 	/** Convert a world location to cockpit-space */
 	bool ProjectWorldLocationToCockpit(FVector World, FVector2D& Cockpit);
 
 	/** Convert a screen location to cockpit-space */
 	bool ScreenToCockpit(FVector2D Screen, FVector2D& Cockpit);
 
+	/** Get the interpolated distortion at a location relative to the distortion grid */
+	FVector2D GetDistortion(float XRelativeLocation, float YRelativeLocation) const;
+
+	/** Bake the distortion grids into the lookup table if the viewport or ship type changed */
+	void UpdateDistortionTable();
+
 
 protected:
 
@@ -245,6 +273,17 @@ protected:
 	FVector2D                               CurrentViewportSize;
 	UCanvas*                                CurrentCanvas;
 
+	// View projection, stored for a HUD pass
+	bool                                    ProjectionValid;
+	FMatrix                                 ViewProjectionMatrix;
+	FIntRect                                ViewRect;
+	TArray<FFlareHUDTarget>                 HUDTargets;
+
+	// Hostility colors, valid until relations change
+	TMap<UFlareCompany*, FLinearColor>      HostilityColors;
+	TWeakObjectPtr<UFlareWorld>             HostilityColorsWorld;
+	int32                                   HostilityColorsVersion;
+
 	// Hit target
 	AFlareSpacecraft*                       PlayerHitSpacecraft;
 	EFlareDamage::Type                      PlayerDamageType;
@@ -304,6 +343,16 @@ protected:
 	// Debug
 	uint32                                  DistortionGrid;
 
+	// Cockpit positions baked from the distortion grids, for a viewport and ship type
+	TArray<FVector2D>                       DistortionTable;
+	int32                                   DistortionTableSubdivisions;
+	int32                                   DistortionTableWidth;
+	FVector2D                               DistortionTableScreenSize;
+	FVector2D                               DistortionTableCockpitSize;
+	float                                   DistortionTableExtraHeight;
+	bool                                    DistortionTableMilitary;
+	bool                                    DistortionTableDirty;
+
 public:
 
 	/*----------------------------------------------------
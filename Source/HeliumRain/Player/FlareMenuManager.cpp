@@ -505,6 +505,14 @@ bool AFlareMenuManager::LoadGame()
 {
 	FText Reason;
 	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
+
+	// The loading screen is rendered on its own thread while the game thread is busy loading
+	IFlareLoadingScreenModule* LoadingScreenModule = FModuleManager::LoadModulePtr<IFlareLoadingScreenModule>("HeliumRainLoadingScreen");
+	if (LoadingScreenModule)
+	{
+		LoadingScreenModule->StartInGameLoadingScreen();
+	}
+
 	PC->GetGame()->LoadGame(PC);
 	
 	if(!PC->GetPlayerFleet())
@@ -513,6 +521,11 @@ bool AFlareMenuManager::LoadGame()
 		PC->GetGame()->Recovery();
 	}
 
+	if (LoadingScreenModule)
+	{
+		LoadingScreenModule->StopInGameLoadingScreen();
+	}
+
 	// No player ship ? Get one !
 	UFlareSimulatedSpacecraft* CurrentShip = PC->GetPlayerShip();
 	if (CurrentShip)
@@ -676,7 +689,10 @@ void AFlareMenuManager::FastForwardSingle()
 
 		// reload sector
 		PC->GetGame()->ActivateCurrentSector();
-		PC->FlyShip(PC->GetShipPawn());
+		if (PC->GetShipPawn())
+		{
+			PC->FlyShip(PC->GetShipPawn());
+		}
 
 		// Notify date
 		PC->Notify(LOCTEXT("NewDate", "A day passed by..."),
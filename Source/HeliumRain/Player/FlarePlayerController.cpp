@@ -674,7 +674,7 @@ bool AFlarePlayerController::SwitchToNextShip(bool Instant)
 
 	if (GetGame()->GetActiveSector() && Company)
 	{
-		TArray<AFlareSpacecraft*> CompanyShips = GetGame()->GetActiveSector()->GetCompanyShips(Company);
+		const TArray<AFlareSpacecraft*>& CompanyShips = GetGame()->GetActiveSector()->GetCompanyShips(Company);
 
 		if (CompanyShips.Num())
 		{
@@ -1258,6 +1258,11 @@ void AFlarePlayerController::ToggleCombat()
 
 void AFlarePlayerController::TogglePilot()
 {
+	if (!ShipPawn)
+	{
+		return;
+	}
+
 	bool NewState = !ShipPawn->GetStateManager()->IsPilotMode();
 	FLOGV("AFlarePlayerController::TooglePilot : new state is %d", NewState);
 	ShipPawn->GetStateManager()->EnablePilot(NewState, true);
@@ -1375,7 +1380,7 @@ void AFlarePlayerController::WheelPressed()
 		MenuManager->CloseMainOverlay();
 	}
 
-	if (GetGame()->IsLoadedOrCreated() && MenuManager && !MenuManager->IsMenuOpen() && !GetNavHUD()->IsWheelMenuOpen())
+	if (GetGame()->IsLoadedOrCreated() && ShipPawn && MenuManager && !MenuManager->IsMenuOpen() && !GetNavHUD()->IsWheelMenuOpen())
 	{
 		TSharedPtr<SFlareMouseMenu> MouseMenu = GetNavHUD()->GetMouseMenu();
 
@@ -13,7 +13,8 @@
 
 UFlareQuest::UFlareQuest(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer),
-	  TrackObjectives(false)
+	  TrackObjectives(false),
+	  ConditionCacheVersion(-1)
 {
 }
 
@@ -210,6 +211,32 @@ bool UFlareQuest::CheckConditions(const TArray<FFlareQuestConditionDescription>&
 }
 
 bool UFlareQuest::CheckCondition(const FFlareQuestConditionDescription* Condition, bool EmptyResult)
+{
+	// Continuous conditions are evaluated each time
+	if (IsContinuousCondition(Condition))
+	{
+		return EvaluateCondition(Condition, EmptyResult);
+	}
+
+	// Others only change on game events
+	if (ConditionCacheVersion != QuestManager->GetEventVersion())
+	{
+		ConditionCache.Empty();
+		ConditionCacheVersion = QuestManager->GetEventVersion();
+	}
+
+	bool* CachedStatus = ConditionCache.Find(Condition);
+	if (CachedStatus)
+	{
+		return *CachedStatus;
+	}
+
+	bool Status = EvaluateCondition(Condition, EmptyResult);
+	ConditionCache.Add(Condition, Status);
+	return Status;
+}
+
+bool UFlareQuest::EvaluateCondition(const FFlareQuestConditionDescription* Condition, bool EmptyResult)
 {
 	bool Status = false;
 
@@ -1050,9 +1077,13 @@ TArray<EFlareQuestCallback::Type> UFlareQuest::GetConditionCallbacks(const FFlar
 		case EFlareQuestCondition::SHIP_MIN_ROLL_VELOCITY:
 		case EFlareQuestCondition::SHIP_MAX_ROLL_VELOCITY:
 		case EFlareQuestCondition::SHIP_FOLLOW_RELATIVE_WAYPOINTS:
-		case EFlareQuestCondition::SHIP_ALIVE:
 			Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
 			break;
+		case EFlareQuestCondition::SHIP_ALIVE:
+			Callbacks.AddUnique(EFlareQuestCallback::FLY_SHIP);
+			Callbacks.AddUnique(EFlareQuestCallback::SPACECRAFT_DESTROYED);
+			Callbacks.AddUnique(EFlareQuestCallback::WORLD_SIMULATED);
+			break;
 		case EFlareQuestCondition::QUEST_SUCCESSFUL:
 		case EFlareQuestCondition::QUEST_FAILED:
 			Callbacks.AddUnique(EFlareQuestCallback::QUEST);
@@ -1065,6 +1096,32 @@ TArray<EFlareQuestCallback::Type> UFlareQuest::GetConditionCallbacks(const FFlar
 	return Callbacks;
 }
 
+bool UFlareQuest::IsContinuousCondition(const FFlareQuestConditionDescription* Condition)
+{
+	switch (Condition->Type)
+	{
+		case EFlareQuestCondition::SHIP_MIN_COLLINEAR_VELOCITY:
+		case EFlareQuestCondition::SHIP_MAX_COLLINEAR_VELOCITY:
+		case EFlareQuestCondition::SHIP_MIN_COLLINEARITY:
+		case EFlareQuestCondition::SHIP_MAX_COLLINEARITY:
+		case EFlareQuestCondition::SHIP_MIN_PITCH_VELOCITY:
+		case EFlareQuestCondition::SHIP_MAX_PITCH_VELOCITY:
+		case EFlareQuestCondition::SHIP_MIN_YAW_VELOCITY:
+		case EFlareQuestCondition::SHIP_MAX_YAW_VELOCITY:
+		case EFlareQuestCondition::SHIP_MIN_ROLL_VELOCITY:
+		case EFlareQuestCondition::SHIP_MAX_ROLL_VELOCITY:
+		case EFlareQuestCondition::SHIP_FOLLOW_RELATIVE_WAYPOINTS:
+			return true;
+
+		// Shared conditions are not cached themselves, their content is
+		case EFlareQuestCondition::SHARED_CONDITION:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
 void UFlareQuest::OnTick(float DeltaSeconds)
 {
 	UpdateState();
@@ -1091,6 +1148,16 @@ void UFlareQuest::OnSectorVisited(UFlareSimulatedSector* Sector)
 	UpdateState();
 }
 
+void UFlareQuest::OnSpacecraftDestroyed(AFlareSpacecraft* Spacecraft)
+{
+	UpdateState();
+}
+
+void UFlareQuest::OnWorldSimulated()
+{
+	UpdateState();
+}
+
 
 
 /*----------------------------------------------------
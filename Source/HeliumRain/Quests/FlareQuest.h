@@ -280,6 +280,12 @@ public:
 
 	virtual bool CheckCondition(const FFlareQuestConditionDescription* Condition, bool EmptyResult);
 
+	/** Evaluate a condition, without using the cached results */
+	virtual bool EvaluateCondition(const FFlareQuestConditionDescription* Condition, bool EmptyResult);
+
+	/** Check if a condition needs to be polled each tick, instead of waiting for game events */
+	static bool IsContinuousCondition(const FFlareQuestConditionDescription* Condition);
+
 	virtual void PerformActions(const TArray<FFlareQuestActionDescription>& Actions);
 
 	virtual void PerformAction(const FFlareQuestActionDescription* Action);
@@ -324,6 +330,10 @@ public:
 
 	virtual void OnQuestStatusChanged(UFlareQuest* Quest);
 
+	virtual void OnSpacecraftDestroyed(AFlareSpacecraft* Spacecraft);
+
+	virtual void OnWorldSimulated();
+
 
 protected:
 
@@ -340,6 +350,10 @@ protected:
 
 	bool									TrackObjectives;
 
+	// Results of event-driven conditions, valid until the next game event
+	TMap<const FFlareQuestConditionDescription*, bool> ConditionCache;
+	int32									ConditionCacheVersion;
+
 
 public:
 
@@ -8,6 +8,8 @@
 
 #define LOCTEXT_NAMESPACE "FlareQuestManager"
 
+DECLARE_CYCLE_STAT(TEXT("FlareQuestManager Tick"), STAT_FlareQuestManager_Tick, STATGROUP_Flare);
+
 
 /*----------------------------------------------------
 	Constructor
@@ -15,6 +17,7 @@
 
 UFlareQuestManager::UFlareQuestManager(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, EventVersion(0)
 {
 }
 
@@ -206,6 +209,12 @@ void UFlareQuestManager::LoadCallbacks(UFlareQuest* Quest)
 		case EFlareQuestCallback::QUEST:
 			QuestCallback.Add(Quest);
 			break;
+		case EFlareQuestCallback::SPACECRAFT_DESTROYED:
+			SpacecraftDestroyedCallback.Add(Quest);
+			break;
+		case EFlareQuestCallback::WORLD_SIMULATED:
+			WorldSimulatedCallback.Add(Quest);
+			break;
 		default:
 			FLOGV("Bad callback type %d for quest %s", (int)(Callbacks[i] + 0), *Quest->GetIdentifier().ToString());
 		}
@@ -216,51 +225,121 @@ void UFlareQuestManager::ClearCallbacks(UFlareQuest* Quest)
 {
 	TickFlyingCallback.Remove(Quest);
 	FlyShipCallback.Remove(Quest);
+	SectorVisitedCallback.Remove(Quest);
+	SectorActiveCallback.Remove(Quest);
+	QuestCallback.Remove(Quest);
+	SpacecraftDestroyedCallback.Remove(Quest);
+	WorldSimulatedCallback.Remove(Quest);
 }
 
 void UFlareQuestManager::OnTick(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_FlareQuestManager_Tick);
+
+	// Only quests with continuous conditions are ticked
 	if (GetGame()->GetActiveSector())
 	{
 		// Tick TickFlying callback only if there is an active sector
-		for (int i = 0; i < TickFlyingCallback.Num(); i++)
+		// Quests may register or clear callbacks while they are notified
+		TArray<UFlareQuest*> Quests = TickFlyingCallback;
+		for (int i = 0; i < Quests.Num(); i++)
 		{
-			TickFlyingCallback[i]->OnTick(DeltaSeconds);
+			if (TickFlyingCallback.Contains(Quests[i]))
+			{
+				Quests[i]->OnTick(DeltaSeconds);
+			}
 		}
 	}
 }
 
 void UFlareQuestManager::OnFlyShip(AFlareSpacecraft* Ship)
 {
-	for (int i = 0; i < FlyShipCallback.Num(); i++)
+	EventVersion++;
+
+	// Quests may register or clear callbacks while they are notified
+	TArray<UFlareQuest*> Quests = FlyShipCallback;
+	for (int i = 0; i < Quests.Num(); i++)
 	{
-		FlyShipCallback[i]->OnFlyShip(Ship);
+		if (FlyShipCallback.Contains(Quests[i]))
+		{
+			Quests[i]->OnFlyShip(Ship);
+		}
 	}
 }
 
 void UFlareQuestManager::OnSectorActivation(UFlareSimulatedSector* Sector)
 {
-	for (int i = 0; i < SectorActiveCallback.Num(); i++)
+	EventVersion++;
+
+	// Quests may register or clear callbacks while they are notified
+	TArray<UFlareQuest*> Quests = SectorActiveCallback;
+	for (int i = 0; i < Quests.Num(); i++)
 	{
-		SectorActiveCallback[i]->OnSectorActivation(Sector);
+		if (SectorActiveCallback.Contains(Quests[i]))
+		{
+			Quests[i]->OnSectorActivation(Sector);
+		}
 	}
 }
 
 void UFlareQuestManager::OnSectorVisited(UFlareSimulatedSector* Sector)
 {
-	for (int i = 0; i < SectorVisitedCallback.Num(); i++)
+	EventVersion++;
+
+	// Quests may register or clear callbacks while they are notified
+	TArray<UFlareQuest*> Quests = SectorVisitedCallback;
+	for (int i = 0; i < Quests.Num(); i++)
 	{
-		SectorVisitedCallback[i]->OnSectorVisited(Sector);
+		if (SectorVisitedCallback.Contains(Quests[i]))
+		{
+			Quests[i]->OnSectorVisited(Sector);
+		}
 	}
 }
 
 void UFlareQuestManager::OnQuestStatusChanged(UFlareQuest* Quest)
 {
+	EventVersion++;
 	LoadCallbacks(Quest);
 
-	for (int i = 0; i < QuestCallback.Num(); i++)
+	// Quests may register or clear callbacks while they are notified
+	TArray<UFlareQuest*> Quests = QuestCallback;
+	for (int i = 0; i < Quests.Num(); i++)
 	{
-		QuestCallback[i]->OnQuestStatusChanged(Quest);
+		if (QuestCallback.Contains(Quests[i]))
+		{
+			Quests[i]->OnQuestStatusChanged(Quest);
+		}
+	}
+}
+
+void UFlareQuestManager::OnSpacecraftDestroyed(AFlareSpacecraft* Spacecraft)
+{
+	EventVersion++;
+
+	// Quests may register or clear callbacks while they are notified
+	TArray<UFlareQuest*> Quests = SpacecraftDestroyedCallback;
+	for (int i = 0; i < Quests.Num(); i++)
+	{
+		if (SpacecraftDestroyedCallback.Contains(Quests[i]))
+		{
+			Quests[i]->OnSpacecraftDestroyed(Spacecraft);
+		}
+	}
+}
+
+void UFlareQuestManager::OnWorldSimulated()
+{
+	EventVersion++;
+
+	// Quests may register or clear callbacks while they are notified
+	TArray<UFlareQuest*> Quests = WorldSimulatedCallback;
+	for (int i = 0; i < Quests.Num(); i++)
+	{
+		if (WorldSimulatedCallback.Contains(Quests[i]))
+		{
+			Quests[i]->OnWorldSimulated();
+		}
 	}
 }
 
@@ -18,7 +18,9 @@ namespace EFlareQuestCallback
 		SECTOR_VISITED, // Trig when a sector is visited
 		SECTOR_ACTIVE, // Trig when a sector is activated
 		FLY_SHIP, // Trig the quest when a ship is flyed
-		QUEST // Trig when a quest status change
+		QUEST, // Trig when a quest status change
+		SPACECRAFT_DESTROYED, // Trig when a spacecraft is destroyed in the active sector
+		WORLD_SIMULATED // Trig when a day has been simulated
 	};
 }
 
@@ -126,6 +128,10 @@ public:
 
 	virtual void OnQuestStatusChanged(UFlareQuest* Quest);
 
+	virtual void OnSpacecraftDestroyed(AFlareSpacecraft* Spacecraft);
+
+	virtual void OnWorldSimulated();
+
 	virtual void OnQuestSuccess(UFlareQuest* Quest);
 
 	virtual void OnQuestFail(UFlareQuest* Quest);
@@ -155,6 +161,11 @@ protected:
 	TArray<UFlareQuest*>	                 SectorActiveCallback;
 	TArray<UFlareQuest*>	                 TickFlyingCallback;
 	TArray<UFlareQuest*>	                 QuestCallback;
+	TArray<UFlareQuest*>	                 SpacecraftDestroyedCallback;
+	TArray<UFlareQuest*>	                 WorldSimulatedCallback;
+
+	// Incremented on each game event, invalidates cached condition results
+	int32                                    EventVersion;
 
 	FFlareQuestSave			                 QuestData;
 
@@ -171,6 +182,11 @@ public:
 		return Game;
 	}
 
+	inline int32 GetEventVersion() const
+	{
+		return EventVersion;
+	}
+
 	inline UFlareQuest* GetSelectedQuest()
 	{
 		return SelectedQuest;
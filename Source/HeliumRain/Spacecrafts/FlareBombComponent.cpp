@@ -23,7 +23,7 @@ UStaticMesh* UFlareBombComponent::GetMesh(bool PresentationMode) const
 	if (ComponentDescription)
 	{
 		//FLOGV("UFlareBombComponent::GetMesh OK %s", *this->GetReadableName());
-		return ComponentDescription->Mesh;
+		return ComponentDescription->GetMesh();
 	}
 	//FLOG("UFlareBombComponent::GetMesh KO");
 
@@ -2,7 +2,6 @@
 #include "../Game/FlareCompany.h"
 #include "../Game/FlareSector.h"
 #include "../Game/FlareGame.h"
-#include "../Game/FlareCollider.h"
 #include "FlareRCS.h"
 #include "FlareOrbitalEngine.h"
 #include "FlareWeapon.h"
@@ -11,6 +10,7 @@
 
 
 DECLARE_CYCLE_STAT(TEXT("PilotHelper CheckFriendlyFire"), STAT_PilotHelper_CheckFriendlyFire, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("PilotHelper AnticollisionCorrection"), STAT_PilotHelper_AnticollisionCorrection, STATGROUP_Flare);
 
 
 bool PilotHelper::CheckFriendlyFire(UFlareSector* Sector, UFlareCompany* MyCompany, FVector FireBaseLocation, FVector FireBaseVelocity , float AmmoVelocity, FVector FireAxis, float MaxDelay, float AimRadius)
@@ -69,46 +69,44 @@ bool PilotHelper::CheckFriendlyFire(UFlareSector* Sector, UFlareCompany* MyCompa
 
 FVector PilotHelper::AnticollisionCorrection(AFlareSpacecraft* Ship, FVector InitialVelocity, AFlareSpacecraft* SpacecraftToIgnore)
 {
+	SCOPE_CYCLE_COUNTER(STAT_PilotHelper_AnticollisionCorrection);
+
 	UFlareSector* ActiveSector = Ship->GetGame()->GetActiveSector();
 	AActor* MostDangerousCandidateActor = NULL;
 
-	FBox ShipBox = Ship->GetComponentsBoundingBox();
+	// Bounds are computed once per frame by the sector
+	const FFlareAnticollisionObstacle* ShipObstacle = ActiveSector->GetSpacecraftObstacle(Ship);
+	if (!ShipObstacle)
+	{
+		return InitialVelocity;
+	}
+
 	FVector CurrentVelocity = Ship->GetLinearVelocity() * 100;
-	FVector CurrentLocation = (ShipBox.Max + ShipBox.Min) / 2.0;	
+	FVector CurrentLocation = ShipObstacle->Location;
 	FVector MostDangerousLocation;
 
-	float CurrentSize = FMath::Max(ShipBox.GetExtent().Size(), 1.0f);
+	float CurrentSize = ShipObstacle->Size;
 	float MostDangerousHitTime = 0;
 	float MostDangerousInterCollisionTravelTime = 0;
 
-	// Investigate ships
-	for (auto SpacecraftCandidate : ActiveSector->GetSpacecrafts())
+	// Investigate ships, asteroids and colliders that can be reached soon
+	TArray<const FFlareAnticollisionObstacle*> Obstacles;
+	ActiveSector->GetAnticollisionObstacles(Ship, Obstacles);
+	for (int32 ObstacleIndex = 0; ObstacleIndex < Obstacles.Num(); ObstacleIndex++)
 	{
-		if (SpacecraftCandidate != Ship
-		 && SpacecraftCandidate != SpacecraftToIgnore
-		 && !Ship->GetDockingSystem()->IsGrantedShip(SpacecraftCandidate)
-		 && !Ship->GetDockingSystem()->IsDockedShip(SpacecraftCandidate))
+		const FFlareAnticollisionObstacle* Obstacle = Obstacles[ObstacleIndex];
+		AFlareSpacecraft* SpacecraftCandidate = Cast<AFlareSpacecraft>(Obstacle->Actor);
+
+		if (SpacecraftCandidate
+		 && (SpacecraftCandidate == Ship
+		  || SpacecraftCandidate == SpacecraftToIgnore
+		  || Ship->GetDockingSystem()->IsGrantedShip(SpacecraftCandidate)
+		  || Ship->GetDockingSystem()->IsDockedShip(SpacecraftCandidate)))
 		{
-			CheckRelativeDangerosity(SpacecraftCandidate, CurrentLocation, CurrentSize, SpacecraftCandidate->Airframe->GetPhysicsLinearVelocity(),
-				CurrentVelocity, &MostDangerousCandidateActor, &MostDangerousLocation, &MostDangerousHitTime, &MostDangerousInterCollisionTravelTime);
+			continue;
 		}
-	}
-
-	// Investigate asteroids
-	for (auto AsteroidCandidate : ActiveSector->GetAsteroids())
-	{
-		CheckRelativeDangerosity(AsteroidCandidate, CurrentLocation, CurrentSize, AsteroidCandidate->GetAsteroidComponent()->GetPhysicsLinearVelocity(),
-			CurrentVelocity, &MostDangerousCandidateActor, &MostDangerousLocation, &MostDangerousHitTime, &MostDangerousInterCollisionTravelTime);
-	}
 
-	// Investigate colliders
-	TArray<AActor*> ColliderActorList;
-	UGameplayStatics::GetAllActorsOfClass(Ship->GetWorld(), AFlareCollider::StaticClass(), ColliderActorList);
-	for (auto ColliderCandidate : ColliderActorList)
-	{
-		AFlareCollider* Collider = Cast<AFlareCollider>(ColliderCandidate);
-	
-		CheckRelativeDangerosity(Collider, CurrentLocation, CurrentSize, FVector::ZeroVector,
+		CheckRelativeDangerosity(Obstacle->Actor, Obstacle->Location, Obstacle->Size, CurrentLocation, CurrentSize, Obstacle->Velocity,
 			CurrentVelocity, &MostDangerousCandidateActor, &MostDangerousLocation, &MostDangerousHitTime, &MostDangerousInterCollisionTravelTime);
 	}
 
@@ -428,7 +426,7 @@ UFlareSpacecraftComponent* PilotHelper::GetBestTargetComponent(AFlareSpacecraft*
 	return ComponentSelection[ComponentIndex];
 }
 
-void PilotHelper::CheckRelativeDangerosity(AActor* CandidateActor, FVector CurrentLocation, float CurrentSize, FVector TargetVelocity, FVector CurrentVelocity, AActor** MostDangerousCandidateActor, FVector*MostDangerousLocation, float* MostDangerousHitTime, float* MostDangerousInterCollisionTravelTime)
+void PilotHelper::CheckRelativeDangerosity(AActor* CandidateActor, FVector CandidateLocation, float CandidateSize, FVector CurrentLocation, float CurrentSize, FVector TargetVelocity, FVector CurrentVelocity, AActor** MostDangerousCandidateActor, FVector*MostDangerousLocation, float* MostDangerousHitTime, float* MostDangerousInterCollisionTravelTime)
 {
 	//FLOGV("PilotHelper::CheckRelativeDangerosity for %s, ship size %f", *CandidateActor->GetName(), CurrentSize);
 
@@ -440,21 +438,6 @@ void PilotHelper::CheckRelativeDangerosity(AActor* CandidateActor, FVector Curre
 		return;
 	}
 	
-	// Get the object size & location
-	float CandidateSize;
-	FVector CandidateLocation;
-	if (CandidateActor->IsA(AFlareCollider::StaticClass()) || CandidateActor->IsA(AFlareAsteroid::StaticClass()))
-	{
-		CandidateSize = Cast<UStaticMeshComponent>(CandidateActor->GetRootComponent())->Bounds.SphereRadius;
-		CandidateLocation = CandidateActor->GetActorLocation();
-	}
-	else
-	{
-		FBox CandidateBox = CandidateActor->GetComponentsBoundingBox();
-		CandidateSize = FMath::Max(CandidateBox.GetExtent().Size(), 1.0f);
-		CandidateLocation = (CandidateBox.Max + CandidateBox.Min) / 2.0;
-	}
-	
 	// Already intersecting ?
 	FVector DeltaLocation = CandidateLocation - CurrentLocation;
 	float SizeSum = CurrentSize + CandidateSize;
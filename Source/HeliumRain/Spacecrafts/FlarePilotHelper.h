@@ -53,7 +53,7 @@ struct PilotHelper
 private:
 
 
-	static void CheckRelativeDangerosity(AActor* CandidateActor, FVector CurrentLocation, float CurrentSize, FVector TargetVelocity, FVector CurrentVelocity,
+	static void CheckRelativeDangerosity(AActor* CandidateActor, FVector CandidateLocation, float CandidateSize, FVector CurrentLocation, float CurrentSize, FVector TargetVelocity, FVector CurrentVelocity,
 		AActor** MostDangerousCandidateActor, FVector*MostDangerousLocation, float* MostDangerousHitTime, float* MostDangerousInterCollisionTravelTime);
 
 };
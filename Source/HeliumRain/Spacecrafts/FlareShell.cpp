@@ -5,6 +5,8 @@
 #include "../Game/FlareGame.h"
 #include "../Player/FlarePlayerController.h"
 
+DECLARE_CYCLE_STAT(TEXT("FlareShell CheckFuze"), STAT_FlareShell_CheckFuze, STATGROUP_Flare);
+
 
 /*----------------------------------------------------
 	Constructor
@@ -136,123 +138,106 @@ void AFlareShell::Tick(float DeltaSeconds)
 
 void AFlareShell::CheckFuze(FVector ActorLocation, FVector NextActorLocation)
 {
-	FVector Center = (NextActorLocation + ActorLocation) / 2;
-	float NearThresoldSquared = FMath::Square(100000); // 1km
-	UFlareSector* Sector = ParentWeapon->GetSpacecraft()->GetGame()->GetActiveSector();
-	for (int32 SpacecraftIndex = 0; SpacecraftIndex < Sector->GetSpacecrafts().Num(); SpacecraftIndex++)
-	{
-		AFlareSpacecraft* ShipCandidate = Sector->GetSpacecrafts()[SpacecraftIndex];
-
-
-		if (ShipCandidate == ParentWeapon->GetSpacecraft())
-		{
-			// Ignore parent spacecraft
-			continue;
-		}
-
-		// First check if near to filter distant ship
-		if ((Center - ShipCandidate->GetActorLocation()).SizeSquared() > NearThresoldSquared)
-		{
-			continue;
-		}
-
-		/*FLOG("=================");
-		FLOGV("Proximity fuze near ship for %s",*GetHumanReadableName());
-*/
-
-		FVector ShellDirection = ShellVelocity.GetUnsafeNormal();
-		FVector CandidateOffset = ShipCandidate->GetActorLocation() - ActorLocation;
-		FVector NextCandidateOffset = ShipCandidate->GetActorLocation() - NextActorLocation;
+	SCOPE_CYCLE_COUNTER(STAT_FlareShell_CheckFuze);
 
-		// Min distance
-		float MinDistance = FVector::CrossProduct(CandidateOffset, ShellDirection).Size() / ShellDirection.Size();
-
-		// Check if the min distance is not in the past
-		if (FVector::DotProduct(CandidateOffset, ShellDirection) < 0)
-		{
-			// The target is behind the shell
-			MinDistance = CandidateOffset.Size();
-		}
+	FVector Center = (NextActorLocation + ActorLocation) / 2;
+	FVector ShellDirection = ShellVelocity.GetUnsafeNormal();
+	float StepDistance = (NextActorLocation - ActorLocation).Size();
 
-		bool MinInFuture = false;
-		// Check if the min distance is not in the future
-		if (FVector::DotProduct(NextCandidateOffset, ShellDirection) > 0)
-		{
-			// The target is before the shell
-			MinDistance = NextCandidateOffset.Size();
-			MinInFuture = true;
-		}
+	// Broad phase : only ships within 1km
+	UFlareSector* Sector = ParentWeapon->GetSpacecraft()->GetGame()->GetActiveSector();
+	Sector->GetNearSpacecrafts(Center, 100000, FuzeCandidateIndices);
 
+	float MinDistanceThresold = ShellDescription->WeaponCharacteristics.FuzeMinDistanceThresold * 100;
+	float MaxDistanceThresold = ShellDescription->WeaponCharacteristics.FuzeMaxDistanceThresold * 100;
 
+	for (int32 BatchStart = 0; BatchStart < FuzeCandidateIndices.Num(); BatchStart += FUZE_BATCH_SIZE)
+	{
+		int32 BatchCount = FMath::Min(FUZE_BATCH_SIZE, FuzeCandidateIndices.Num() - BatchStart);
 
-		float DistanceToMinDistancePoint;
-		if (CandidateOffset.Size() == MinDistance)
-		{
-			DistanceToMinDistancePoint = 0;
-		}
-		else if (NextCandidateOffset.Size() == MinDistance)
-		{
-			DistanceToMinDistancePoint = (NextActorLocation - ActorLocation).Size();
-		}
-		else
+		// Gather candidates
+		FFlareFuzeBatch Batch;
+		for (int32 Index = 0; Index < BatchCount; Index++)
 		{
-			DistanceToMinDistancePoint = FMath::Sqrt(CandidateOffset.SizeSquared() - FMath::Square(MinDistance));
+			int32 SpacecraftIndex = FuzeCandidateIndices[BatchStart + Index];
+			FVector CandidateOffset = Sector->GetBroadPhaseLocation(SpacecraftIndex) - ActorLocation;
+			Batch.OffsetX[Index] = CandidateOffset.X;
+			Batch.OffsetY[Index] = CandidateOffset.Y;
+			Batch.OffsetZ[Index] = CandidateOffset.Z;
+			Batch.Size[Index] = Sector->GetBroadPhaseSize(SpacecraftIndex);
 		}
 
-	/*	FLOGV("ShipCandidate->GetMeshScale() %f",ShipCandidate->GetMeshScale());
-		FLOGV("DistanceToMinDistancePoint %f",DistanceToMinDistancePoint);
-		FLOGV("Step distance %f",(NextActorLocation - ActorLocation).Size());
-		FLOGV("MinDistance %f",MinDistance);
-		FLOGV("Start Distance %f",(ActorLocation - ShipCandidate->GetActorLocation()).Size());
-		FLOGV("End Distance %f",(NextActorLocation - ShipCandidate->GetActorLocation()).Size());
-*/
+		// Closest approach of the whole batch
+		ComputeFuzeBatch(Batch, BatchCount, ShellDirection, StepDistance);
 
-		// Check if need to detonnate
-		float EffectiveDistance = MinDistance - ShipCandidate->GetMeshScale();
-
-
-		if (EffectiveDistance < ShellDescription->WeaponCharacteristics.FuzeMinDistanceThresold *100)
+		// Decide in sector order, as the fuze state depends on previous candidates
+		for (int32 Index = 0; Index < BatchCount; Index++)
 		{
-			// Detonate because of too near. Find the detonate point.
-
-
-			float MinThresoldDistance = ShellDescription->WeaponCharacteristics.FuzeMinDistanceThresold *100 + ShipCandidate->GetMeshScale();
-
-		// 	FLOGV("MinThresoldDistance %f",MinThresoldDistance);
-			float DistanceToMinThresoldDistancePoint = FMath::Sqrt(FMath::Square(MinThresoldDistance) - FMath::Square(MinDistance));
-		// 	FLOGV("DistanceToMinThresoldDistancePoint %f",DistanceToMinThresoldDistancePoint);
+			AFlareSpacecraft* ShipCandidate = Sector->GetSpacecrafts()[FuzeCandidateIndices[BatchStart + Index]];
+			if (ShipCandidate == ParentWeapon->GetSpacecraft())
+			{
+				// Ignore parent spacecraft
+				continue;
+			}
 
-			float DistanceToDetonatePoint = DistanceToMinDistancePoint - DistanceToMinThresoldDistancePoint;
-		// 	FLOGV("DistanceToDetonatePoint %f",DistanceToDetonatePoint);
-			FVector DetonatePoint = ActorLocation + ShellDirection * DistanceToDetonatePoint;
+			float MinDistance = Batch.MinDistance[Index];
+			float DistanceToMinDistancePoint = Batch.DistanceToMinDistancePoint[Index];
+			float EffectiveDistance = MinDistance - Batch.Size[Index];
 
-			DetonateAt(DetonatePoint);
-		}
-		else if (Armed && EffectiveDistance > MinEffectiveDistance)
-		{
-			// We are armed and the distance as increase, detonate at nearest point
-			FVector DetonatePoint = ActorLocation + ShellDirection * DistanceToMinDistancePoint;
-			DetonateAt(DetonatePoint);
-		}
-		else if (EffectiveDistance < ShellDescription->WeaponCharacteristics.FuzeMaxDistanceThresold *100)
-		{
-			if (MinInFuture)
+			// Check if need to detonnate
+			if (EffectiveDistance < MinDistanceThresold)
 			{
-				// In activation zone but we will be near in future, arm the fuze
-				Armed = true;
-				MinEffectiveDistance = EffectiveDistance;
+				// Detonate because of too near. Find the detonate point.
+				float MinThresoldDistance = MinDistanceThresold + Batch.Size[Index];
+				float DistanceToMinThresoldDistancePoint = FMath::Sqrt(FMath::Square(MinThresoldDistance) - FMath::Square(MinDistance));
+				float DistanceToDetonatePoint = DistanceToMinDistancePoint - DistanceToMinThresoldDistancePoint;
+				DetonateAt(ActorLocation + ShellDirection * DistanceToDetonatePoint);
+				return;
 			}
-			else
+			else if (Armed && EffectiveDistance > MinEffectiveDistance)
 			{
-				// In activation zone and the min distance is reach in this step, detonate
-				FVector DetonatePoint = ActorLocation + ShellDirection * DistanceToMinDistancePoint;
-			// 	FLOGV("DistanceToMinDistancePoint %f",DistanceToMinDistancePoint);
-				DetonateAt(DetonatePoint);
+				// We are armed and the distance as increase, detonate at nearest point
+				DetonateAt(ActorLocation + ShellDirection * DistanceToMinDistancePoint);
+				return;
+			}
+			else if (EffectiveDistance < MaxDistanceThresold)
+			{
+				if (Batch.MinInFuture[Index])
+				{
+					// In activation zone but we will be near in future, arm the fuze
+					Armed = true;
+					MinEffectiveDistance = EffectiveDistance;
+				}
+				else
+				{
+					// In activation zone and the min distance is reach in this step, detonate
+					DetonateAt(ActorLocation + ShellDirection * DistanceToMinDistancePoint);
+					return;
+				}
 			}
 		}
 	}
 }
 
+void AFlareShell::ComputeFuzeBatch(FFlareFuzeBatch& Batch, int32 Count, FVector ShellDirection, float StepDistance)
+{
+	// Branch-free loop over contiguous arrays so that it can be vectorized
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		float Along = Batch.OffsetX[Index] * ShellDirection.X + Batch.OffsetY[Index] * ShellDirection.Y + Batch.OffsetZ[Index] * ShellDirection.Z;
+		float OffsetSquared = Batch.OffsetX[Index] * Batch.OffsetX[Index] + Batch.OffsetY[Index] * Batch.OffsetY[Index] + Batch.OffsetZ[Index] * Batch.OffsetZ[Index];
+
+		// Clamp the closest point to the step segment
+		float ClampedAlong = FMath::Clamp(Along, 0.f, StepDistance);
+		float Remaining = Along - ClampedAlong;
+		float MinDistanceSquared = OffsetSquared - Along * Along + Remaining * Remaining;
+
+		Batch.MinDistance[Index] = FMath::Sqrt(FMath::Max(MinDistanceSquared, 0.f));
+		Batch.DistanceToMinDistancePoint[Index] = ClampedAlong;
+		Batch.MinInFuture[Index] = (Along > StepDistance);
+	}
+}
+
 
 void AFlareShell::OnImpact(const FHitResult& HitResult, const FVector& HitVelocity)
 {
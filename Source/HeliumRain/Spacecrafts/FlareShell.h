@@ -3,6 +3,23 @@
 #include "FlareWeapon.h"
 #include "FlareShell.generated.h"
 
+#define FUZE_BATCH_SIZE 16
+
+/** Proximity fuze candidates, as contiguous arrays */
+struct FFlareFuzeBatch
+{
+	// Input : candidate offset from the shell, and candidate size
+	float OffsetX[FUZE_BATCH_SIZE];
+	float OffsetY[FUZE_BATCH_SIZE];
+	float OffsetZ[FUZE_BATCH_SIZE];
+	float Size[FUZE_BATCH_SIZE];
+
+	// Output : closest approach during this step
+	float MinDistance[FUZE_BATCH_SIZE];
+	float DistanceToMinDistancePoint[FUZE_BATCH_SIZE];
+	bool MinInFuture[FUZE_BATCH_SIZE];
+};
+
 UCLASS(Blueprintable, ClassGroup = (Flare, Ship), meta = (BlueprintSpawnableComponent))
 class AFlareShell : public AActor
 {
@@ -39,6 +56,9 @@ public:
 
 	virtual void CheckFuze(FVector ActorLocation, FVector NextActorLocation);
 
+	/** Compute the closest approach of a shell step to a batch of candidates */
+	static void ComputeFuzeBatch(FFlareFuzeBatch& Batch, int32 Count, FVector ShellDirection, float StepDistance);
+
 protected:
 
 	/*----------------------------------------------------
@@ -87,6 +107,9 @@ protected:
 	float SecureTime;
 	float ActiveTime;
 
+	// Fuze broad phase results, kept to reuse the allocation
+	TArray<int32>                            FuzeCandidateIndices;
+
 	UFlareWeapon* ParentWeapon;
 	AFlarePlayerController* PC;
 
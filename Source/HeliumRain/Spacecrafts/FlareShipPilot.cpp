@@ -881,7 +881,7 @@ void UFlareShipPilot::IdlePilot(float DeltaSeconds)
 		// If not, find a leader
 		AFlareSpacecraft* LeaderShip = Ship;
 
-		TArray<AFlareSpacecraft*> Spacecrafts = Ship->GetGame()->GetActiveSector()->GetCompanySpacecrafts(Ship->GetCompany());
+		const TArray<AFlareSpacecraft*>& Spacecrafts = Ship->GetGame()->GetActiveSector()->GetCompanySpacecrafts(Ship->GetCompany());
 		for (int ShipIndex = 0; ShipIndex < Spacecrafts.Num() ; ShipIndex++)
 		{
 			AFlareSpacecraft* CandidateShip = Spacecrafts[ShipIndex];
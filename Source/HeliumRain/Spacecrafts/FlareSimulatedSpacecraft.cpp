@@ -7,6 +7,7 @@
 #include "../Economy/FlareCargoBay.h"
 #include "../Economy/FlareFactory.h"
 #include "../Data/FlareFactoryCatalogEntry.h"
+#include "../Game/Save/FlareSaveCache.h"
 #include "FlareSimulatedSpacecraft.h"
 
 
@@ -26,6 +27,7 @@ UFlareSimulatedSpacecraft::UFlareSimulatedSpacecraft(const FObjectInitializer& O
 	: Super(ObjectInitializer)
 {
 	ActiveSpacecraft = NULL;
+	SaveRevision = 0;
 }
 
 
@@ -89,26 +91,44 @@ void UFlareSimulatedSpacecraft::Load(const FFlareSpacecraftSave& Data)
 	{
 		ActiveSpacecraft->Load(this);
 	}
+
+	SetDirty();
 }
 
 FFlareSpacecraftSave* UFlareSimulatedSpacecraft::Save()
 {
-	SpacecraftData.FactoryStates.Empty();
+	// Factories and cargo are owned by their own objects, compare them with the previous save
+	TArray<FFlareFactorySave> FactoryStates;
 	for (int FactoryIndex = 0; FactoryIndex < Factories.Num(); FactoryIndex++)
 	{
-		SpacecraftData.FactoryStates.Add(*Factories[FactoryIndex]->Save());
+		FactoryStates.Add(*Factories[FactoryIndex]->Save());
 	}
 
-	SpacecraftData.Cargo = *CargoBay->Save();
+	TArray<FFlareCargoSave>* Cargo = CargoBay->Save();
 
+	if (!FFlareSaveCache::IsSameData(FactoryStates, SpacecraftData.FactoryStates)
+	 || !FFlareSaveCache::IsSameData(*Cargo, SpacecraftData.Cargo))
+	{
+		SpacecraftData.FactoryStates = FactoryStates;
+		SpacecraftData.Cargo = *Cargo;
+		SetDirty();
+	}
+
+	// Active spacecrafts move all the time
 	if(IsActive())
 	{
 		GetActive()->Save();
+		SetDirty();
 	}
 
 	return &SpacecraftData;
 }
 
+void UFlareSimulatedSpacecraft::SetDirty()
+{
+	SaveRevision = FFlareSaveCache::NewRevision();
+}
+
 
 UFlareCompany* UFlareSimulatedSpacecraft::GetCompany() const
 {
@@ -159,7 +179,11 @@ UFlareSimulatedSpacecraftWeaponsSystem* UFlareSimulatedSpacecraft::GetWeaponsSys
 
 void UFlareSimulatedSpacecraft::SetSpawnMode(EFlareSpawnMode::Type SpawnMode)
 {
-	SpacecraftData.SpawnMode = SpawnMode;
+	if (SpacecraftData.SpawnMode != SpawnMode)
+	{
+		SpacecraftData.SpawnMode = SpawnMode;
+		SetDirty();
+	}
 }
 
 bool UFlareSimulatedSpacecraft::CanBeFlown(FText& OutInfo) const
@@ -365,6 +389,7 @@ void UFlareSimulatedSpacecraft::SetAsteroidData(FFlareAsteroidSave* Data)
 	SpacecraftData.AsteroidData.Scale = Data->Scale;
 	SpacecraftData.Location = Data->Location;
 	SpacecraftData.Rotation = Data->Rotation;
+	SetDirty();
 }
 
 void UFlareSimulatedSpacecraft::SetActorAttachment(FName ActorName)
@@ -373,18 +398,21 @@ void UFlareSimulatedSpacecraft::SetActorAttachment(FName ActorName)
 		*GetImmatriculation().ToString(), *ActorName.ToString());
 
 	SpacecraftData.AttachActorName = ActorName;
+	SetDirty();
 }
 
 void UFlareSimulatedSpacecraft::SetDynamicComponentState(FName Identifier, float Progress)
 {
 	SpacecraftData.DynamicComponentStateIdentifier = Identifier;
 	SpacecraftData.DynamicComponentStateProgress = Progress;
+	SetDirty();
 }
 
 void UFlareSimulatedSpacecraft::ForceUndock()
 {
 	SpacecraftData.DockedTo = NAME_None;
 	SpacecraftData.DockedAt = -1;
+	SetDirty();
 }
 
 void UFlareSimulatedSpacecraft::SetTrading(bool Trading)
@@ -414,22 +442,38 @@ void UFlareSimulatedSpacecraft::SetTrading(bool Trading)
 			Data);
 	}
 
-	SpacecraftData.IsTrading = Trading;
+	if (SpacecraftData.IsTrading != Trading)
+	{
+		SpacecraftData.IsTrading = Trading;
+		SetDirty();
+	}
 }
 
 void UFlareSimulatedSpacecraft::SetRefilling(bool Refilling)
 {
-	SpacecraftData.IsRefilling = Refilling;
+	if (SpacecraftData.IsRefilling != Refilling)
+	{
+		SpacecraftData.IsRefilling = Refilling;
+		SetDirty();
+	}
 }
 
 void UFlareSimulatedSpacecraft::SetRepairing(bool Repairing)
 {
-	SpacecraftData.IsRepairing = Repairing;
+	if (SpacecraftData.IsRepairing != Repairing)
+	{
+		SpacecraftData.IsRepairing = Repairing;
+		SetDirty();
+	}
 }
 
 void UFlareSimulatedSpacecraft::SetReserve(bool InReserve)
 {
-	SpacecraftData.IsReserve = InReserve;
+	if (SpacecraftData.IsReserve != InReserve)
+	{
+		SpacecraftData.IsReserve = InReserve;
+		SetDirty();
+	}
 }
 
 void UFlareSimulatedSpacecraft::SetHarpooned(UFlareCompany* OwnerCompany)
@@ -439,11 +483,13 @@ void UFlareSimulatedSpacecraft::SetHarpooned(UFlareCompany* OwnerCompany)
 		{
 			CombatLog::SpacecraftHarpooned(this, OwnerCompany);
 			SpacecraftData.HarpoonCompany  = OwnerCompany->GetIdentifier();
+			SetDirty();
 		}
 	}
-	else
+	else if (SpacecraftData.HarpoonCompany != NAME_None)
 	{
 		SpacecraftData.HarpoonCompany = NAME_None;
+		SetDirty();
 	}
 }
 
@@ -465,6 +511,8 @@ void UFlareSimulatedSpacecraft::RemoveCapturePoint(FName CompanyIdentifier, int3
 		{
 			SpacecraftData.CapturePoints[CompanyIdentifier] = CurrentCapturePoint - CapturePoint;
 		}
+
+		SetDirty();
 	}
 }
 
@@ -507,6 +555,7 @@ bool UFlareSimulatedSpacecraft::TryCapture(UFlareCompany* Company, int32 Capture
 	{
 		SpacecraftData.CapturePoints.Add(CompanyIdentifier, CurrentCapturePoint);
 	}
+	SetDirty();
 
 	if (CurrentCapturePoint > GetCapturePointThreshold())
 	{
@@ -29,6 +29,9 @@ public:
 	/** Save the ship to a save file */
 	virtual FFlareSpacecraftSave* Save();
 
+	/** Signal that the save data changed since the last save */
+	void SetDirty();
+
 	/** Get the parent company */
 	virtual UFlareCompany* GetCompany() const;
 
@@ -82,6 +85,7 @@ public:
 	void Upgrade()
 	{
 		SpacecraftData.Level++;
+		SetDirty();
 	}
 
 	void SetActiveSpacecraft(AFlareSpacecraft* Spacecraft)
@@ -136,6 +140,7 @@ protected:
 
     // Gameplay data
 	FFlareSpacecraftSave          SpacecraftData;
+	uint64                        SaveRevision;
 	FFlareSpacecraftDescription*  SpacecraftDescription;
 
 	AFlareGame*                   Game;
@@ -172,6 +177,12 @@ public:
 		return ActiveSpacecraft != NULL;
 	}
 
+	/** Revision of the save data, changed each time the data is modified */
+	inline uint64 GetSaveRevision() const
+	{
+		return SaveRevision;
+	}
+
 	inline AFlareSpacecraft* GetActive() const
 	{
 		return ActiveSpacecraft;
@@ -182,6 +193,11 @@ public:
 		return SpacecraftData;
 	}
 
+	inline const FFlareSpacecraftSave& GetData() const
+	{
+		return SpacecraftData;
+	}
+
 	inline FText GetNickName() const
 	{
 		return SpacecraftData.NickName;
@@ -67,6 +67,13 @@ AFlareSpacecraft::AFlareSpacecraft(const class FObjectInitializer& PCIP)
 	StateManager = NULL;
 	CurrentTarget = NULL;
 	NavigationSystem = NULL;
+
+	// AI level of detail
+	AILevelOfDetail = 0;
+	AIFramesSinceUpdate = 0;
+	AIAccumulatedTime = 0;
+	AIDeltaSeconds = 0;
+	AITickFrame = true;
 }
 
 
@@ -78,6 +85,13 @@ void AFlareSpacecraft::BeginPlay()
 {
 	Super::BeginPlay();
 
+	SetupAsteroidComponents();
+
+	CurrentTarget = NULL;
+}
+
+void AFlareSpacecraft::SetupAsteroidComponents()
+{
 	// Setup asteroid components, if any
 	TArray<UActorComponent*> Components = GetComponentsByClass(UFlareAsteroidComponent::StaticClass());
 	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
@@ -107,8 +121,6 @@ void AFlareSpacecraft::BeginPlay()
 			AsteroidComponent->SetIcy(IsIcy);
 		}
 	}
-
-	CurrentTarget = NULL;
 }
 
 void AFlareSpacecraft::Tick(float DeltaSeconds)
@@ -129,14 +141,21 @@ void AFlareSpacecraft::Tick(float DeltaSeconds)
 
 	if (!IsPresentationMode() && StateManager && !Paused)
 	{
-		// Tick systems
+		// Tick systems, physics and damage every frame, the rest at the AI level of detail rate
 		{
 			SCOPE_CYCLE_COUNTER(STAT_FlareSpacecraft_Systems);
+			UpdateAILevelOfDetail(DeltaSeconds);
 			StateManager->Tick(DeltaSeconds);
-			DockingSystem->TickSystem(DeltaSeconds);
+			if (AITickFrame)
+			{
+				DockingSystem->TickSystem(AIDeltaSeconds);
+			}
 			NavigationSystem->TickSystem(DeltaSeconds);
-			WeaponsSystem->TickSystem(DeltaSeconds);
 			DamageSystem->TickSystem(DeltaSeconds);
+			if (AITickFrame)
+			{
+				WeaponsSystem->TickSystem(AIDeltaSeconds);
+			}
 		}
 
 		// Lights
@@ -361,6 +380,13 @@ void AFlareSpacecraft::NotifyHit(class UPrimitiveComponent* MyComp, class AActor
 }
 
 void AFlareSpacecraft::Destroyed()
+{
+	StopActiveSpacecraft();
+
+	Super::Destroyed();
+}
+
+void AFlareSpacecraft::StopActiveSpacecraft()
 {
 	// Notify PC
 	if(!IsPresentationMode())
@@ -400,8 +426,6 @@ void AFlareSpacecraft::Destroyed()
 		}
 	}
 
-	Super::Destroyed();
-
 	// Clear bombs
 	TArray<UActorComponent*> Components = GetComponentsByClass(UFlareSpacecraftComponent::StaticClass());
 	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
@@ -416,6 +440,71 @@ void AFlareSpacecraft::Destroyed()
 	CurrentTarget = NULL;
 }
 
+void AFlareSpacecraft::PrepareForRecycling()
+{
+	StopActiveSpacecraft();
+
+	// Detach from the parent actor
+	if (AttachedToParentActor)
+	{
+		DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+		AttachedToParentActor = false;
+	}
+
+	// Forget the previous parent so that the next load doesn't touch its data
+	Parent = NULL;
+	Pilot = NULL;
+	DamageSystem = NULL;
+	NavigationSystem = NULL;
+	DockingSystem = NULL;
+	WeaponsSystem = NULL;
+
+	// Remove from the game
+	Airframe->SetSimulatePhysics(false);
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+	SetActorTickEnabled(false);
+
+	TArray<UActorComponent*> Components;
+	GetComponents(Components);
+	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	{
+		Components[ComponentIndex]->SetComponentTickEnabled(false);
+	}
+}
+
+void AFlareSpacecraft::RecycleAt(FVector Location, FRotator Rotation)
+{
+	SetActorLocationAndRotation(Location, Rotation, false, NULL, ETeleportType::TeleportPhysics);
+
+	// Reset gameplay state
+	Paused = false;
+	CustomTimeDilation = 1.0;
+	LastMass = 0;
+	TargetIndex = 0;
+	TimeSinceSelection = 0;
+	AILevelOfDetail = 0;
+	AIFramesSinceUpdate = 0;
+	AIAccumulatedTime = 0;
+	AIDeltaSeconds = 0;
+	AITickFrame = true;
+
+	// Back in the game
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	Airframe->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	SetActorTickEnabled(true);
+
+	TArray<UActorComponent*> Components;
+	GetComponents(Components);
+	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	{
+		Components[ComponentIndex]->SetComponentTickEnabled(Components[ComponentIndex]->PrimaryComponentTick.bStartWithTickEnabled);
+	}
+
+	SetupAsteroidComponents();
+}
+
 void AFlareSpacecraft::SetPause(bool Pause)
 {
 	if (Paused == Pause)
@@ -468,6 +557,32 @@ void AFlareSpacecraft::Redock()
 	}
 }
 
+void AFlareSpacecraft::UpdateAILevelOfDetail(float DeltaSeconds)
+{
+	AIAccumulatedTime += DeltaSeconds;
+	AIFramesSinceUpdate++;
+
+	UFlareSector* ActiveSector = GetGame()->GetActiveSector();
+	if (ActiveSector)
+	{
+		AILevelOfDetail = ActiveSector->GetAILevelOfDetail(this);
+		AITickFrame = ActiveSector->ScheduleAIUpdate(this);
+	}
+	else
+	{
+		AILevelOfDetail = 0;
+		AITickFrame = true;
+	}
+
+	// Consume the accumulated time
+	if (AITickFrame)
+	{
+		AIDeltaSeconds = AIAccumulatedTime;
+		AIAccumulatedTime = 0;
+		AIFramesSinceUpdate = 0;
+	}
+}
+
 float AFlareSpacecraft::GetSpacecraftMass()
 {
 	float Mass = GetDescription()->Mass;
@@ -899,7 +1014,7 @@ void AFlareSpacecraft::UpdateDynamicComponents()
 		}
 		else
 		{
-			Component->SetChildActorClass(*(CurrentState->StateTemplates[TemplateIndex]->GeneratedClass));
+			Component->SetChildActorClass(*(CurrentState->GetStateTemplate(TemplateIndex)->GeneratedClass));
 
 			if (Component->GetChildActor())
 			{
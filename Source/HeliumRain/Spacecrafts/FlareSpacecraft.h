@@ -45,6 +45,12 @@ public:
 
 	virtual void Destroyed() override;
 
+	/** Deactivate the spacecraft so that it can be loaded again for another parent */
+	virtual void PrepareForRecycling();
+
+	/** Reactivate a recycled spacecraft at a new location, before loading it */
+	virtual void RecycleAt(FVector Location, FRotator Rotation);
+
 	virtual void OnRepaired();
 
 	virtual void OnRefilled();
@@ -106,9 +112,15 @@ public:
 	/** Apply the current asteroid data */
 	void ApplyAsteroidData();
 
+	/** Setup the ice of asteroid components for the current sector */
+	void SetupAsteroidComponents();
+
 	void UpdateDynamicComponents();
 	
 	UFlareSimulatedSector* GetOwnerSector();
+
+	/** Update the AI level of detail and decide if AI and systems should update this frame */
+	void UpdateAILevelOfDetail(float DeltaSeconds);
 	
 public:
 
@@ -214,6 +226,9 @@ public:
 
 protected:
 
+	/** Stop all activity and release the parent before destruction or recycling */
+	void StopActiveSpacecraft();
+
 	/*----------------------------------------------------
 		Internal data
 	----------------------------------------------------*/
@@ -276,6 +291,13 @@ protected:
 
 	bool                                           AttachedToParentActor;
 
+	// AI level of detail
+	int32                                          AILevelOfDetail;
+	int32                                          AIFramesSinceUpdate;
+	float                                          AIAccumulatedTime;
+	float                                          AIDeltaSeconds;
+	bool                                           AITickFrame;
+
 	// Joystick settings
 	float                                          JoystickThrustMinSpeed;
 	float                                          JoystickThrustMaxSpeed;
@@ -405,4 +427,26 @@ public:
 	{
 		return Paused;
 	}
+
+	/** Should AI and non-physics systems update this frame */
+	inline bool IsAITickFrame() const
+	{
+		return AITickFrame;
+	}
+
+	/** Time elapsed since the last AI update, to be used instead of the frame delta */
+	inline float GetAIDeltaSeconds() const
+	{
+		return AIDeltaSeconds;
+	}
+
+	inline int32 GetAILevelOfDetail() const
+	{
+		return AILevelOfDetail;
+	}
+
+	inline int32 GetAIFramesSinceUpdate() const
+	{
+		return AIFramesSinceUpdate;
+	}
 };
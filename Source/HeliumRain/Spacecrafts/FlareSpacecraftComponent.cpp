@@ -8,6 +8,17 @@
 #include "FlareOrbitalEngine.h"
 
 #include "StaticMeshResources.h"
+#include "../Data/FlareCatalogLoader.h"
+
+
+/*----------------------------------------------------
+	Description
+----------------------------------------------------*/
+
+UStaticMesh* FFlareSpacecraftComponentDescription::GetMesh() const
+{
+	return Cast<UStaticMesh>(FFlareCatalogLoader::LoadAsset(Mesh.ToStringReference()));
+}
 
 
 /*----------------------------------------------------
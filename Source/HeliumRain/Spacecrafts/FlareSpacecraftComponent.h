@@ -289,8 +289,8 @@ struct FFlareSpacecraftComponentDescription
 	/** Hit point for component fonctionnaly. Component not working when no more hit points */
 	UPROPERTY(EditAnywhere, Category = Content) float HitPoints;
 
-	/** Part mesh name */
-	UPROPERTY(EditAnywhere, Category = Content) UStaticMesh* Mesh;
+	/** Part mesh, loaded on first use */
+	UPROPERTY(EditAnywhere, Category = Content) TAssetPtr<UStaticMesh> Mesh;
 
 	/** Effect used when destroyed*/
 	UPROPERTY(EditAnywhere, Category = Content) UParticleSystem* DestroyedEffect;
@@ -307,6 +307,9 @@ struct FFlareSpacecraftComponentDescription
 	/** Weapon characteristic structure */
 	UPROPERTY(EditAnywhere, Category = Content) FFlareSpacecraftComponentWeaponCharacteristics WeaponCharacteristics;
 
+	/** Get the part mesh, loading it if needed */
+	UStaticMesh* GetMesh() const;
+
 };
 
 
@@ -521,7 +524,8 @@ public:
 
 	virtual UStaticMesh* GetMesh(bool PresentationMode) const
 	{
-		return (ComponentDescription && ComponentDescription->Mesh ? ComponentDescription->Mesh : StaticMesh);
+		UStaticMesh* DescriptionMesh = (ComponentDescription ? ComponentDescription->GetMesh() : NULL);
+		return (DescriptionMesh ? DescriptionMesh : StaticMesh);
 	}
 
 	virtual bool HasLocalHeatEffect() const
@@ -76,9 +76,9 @@ void UFlareSpacecraftStateManager::Tick(float DeltaSeconds)
 	EFlareWeaponGroupType::Type CurrentWeaponType = Spacecraft->GetWeaponsSystem()->GetActiveWeaponType();
 	float MaxVelocity = Spacecraft->GetNavigationSystem()->GetLinearMaxVelocity();
 
-	if (Spacecraft->GetParent()->GetDamageSystem()->IsAlive() && IsPiloted) // Do not tick the pilot if a player has disable the pilot
+	if (Spacecraft->GetParent()->GetDamageSystem()->IsAlive() && IsPiloted && Spacecraft->IsAITickFrame()) // Do not tick the pilot if a player has disable the pilot
 	{
-		Spacecraft->GetPilot()->TickPilot(DeltaSeconds);
+		Spacecraft->GetPilot()->TickPilot(Spacecraft->GetAIDeltaSeconds());
 
 		// Fighters can use different weapons.
 		// If this is needed for capitals too, it needs to check that the player didn't select a group already.
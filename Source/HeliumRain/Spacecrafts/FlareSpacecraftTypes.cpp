@@ -1,5 +1,6 @@
 #include "../Flare.h"
 #include "FlareSpacecraftTypes.h"
+#include "../Data/FlareCatalogLoader.h"
 
 DECLARE_CYCLE_STAT(TEXT("SpacecraftHelper GetIntersectionPosition"), STAT_SpacecraftHelper_GetIntersectionPosition, STATGROUP_Flare);
 
@@ -111,3 +112,13 @@ bool FFlareSpacecraftDescription::IsMilitary()
 {
 	return GunSlots.Num() > 0 || TurretSlots.Num() > 0;
 }
+
+UBlueprint* FFlareSpacecraftDescription::GetTemplate() const
+{
+	return Cast<UBlueprint>(FFlareCatalogLoader::LoadAsset(Template.ToStringReference()));
+}
+
+UBlueprint* FFlareSpacecraftDynamicComponentStateDescription::GetStateTemplate(int32 Index) const
+{
+	return Cast<UBlueprint>(FFlareCatalogLoader::LoadAsset(StateTemplates[Index].ToStringReference()));
+}
@@ -478,9 +478,12 @@ struct FFlareSpacecraftDynamicComponentStateDescription
 	/** Dynamic component state name */
 	UPROPERTY(EditAnywhere, Category = Content) FName StateIdentifier;
 
-	/** Dynamic component state templates */
+	/** Dynamic component state templates, loaded on first use */
 	UPROPERTY(EditAnywhere, Category = Content)
-	TArray<UBlueprint*> StateTemplates;
+	TArray<TAssetPtr<UBlueprint>> StateTemplates;
+
+	/** Get a state template, loading it if needed */
+	UBlueprint* GetStateTemplate(int32 Index) const;
 
 };
 
@@ -692,8 +695,8 @@ struct FFlareSpacecraftDescription
 	/** Heat capacity un KJ/K */
 	UPROPERTY(EditAnywhere, Category = Content) float HeatCapacity;
 
-	/** Spacecraft mesh name */
-	UPROPERTY(EditAnywhere, Category = Content) UBlueprint* Template;
+	/** Spacecraft template, loaded on first use */
+	UPROPERTY(EditAnywhere, Category = Content) TAssetPtr<UBlueprint> Template;
 
 	/** Spacecraft mesh preview image */
 	UPROPERTY(EditAnywhere, Category = Content) FSlateBrush MeshPreviewBrush;
@@ -740,6 +743,9 @@ struct FFlareSpacecraftDescription
 
 	bool IsMilitary();
 
+	/** Get the spacecraft template, loading it if needed */
+	UBlueprint* GetTemplate() const;
+
 	static const FSlateBrush* GetIcon(FFlareSpacecraftDescription* Characteristic);
 };
 
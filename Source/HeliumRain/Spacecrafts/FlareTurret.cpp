@@ -149,9 +149,9 @@ void UFlareTurret::TickComponent(float DeltaTime, enum ELevelTick TickType, FAct
 		return;
 	}
 
-	if (Spacecraft->GetParent()->GetDamageSystem()->IsAlive())
+	if (Spacecraft->GetParent()->GetDamageSystem()->IsAlive() && Spacecraft->IsAITickFrame())
 	{
-		Pilot->TickPilot(DeltaTime);
+		Pilot->TickPilot(Spacecraft->GetAIDeltaSeconds());
 		if (Pilot->IsWantFire())
 		{
 			StartFire();
@@ -293,7 +293,7 @@ void UFlareWeapon::OnRefilled()
 
 void UFlareWeapon::FillBombs()
 {
-	UStaticMeshSocket* BombHardpoint = ComponentDescription->Mesh->FindSocket("Hardpoint");
+	UStaticMeshSocket* BombHardpoint = ComponentDescription->GetMesh()->FindSocket("Hardpoint");
 	//FLOGV("BombHardpoint RelativeLocation=%s", *BombHardpoint->RelativeLocation.ToString());
 	int CurrentBombCount = Bombs.Num();
 
@@ -588,6 +588,7 @@ void UFlareSimulatedSpacecraftDamageSystem::SetPowerDirty()
 void UFlareSimulatedSpacecraftDamageSystem::SetDamageDirty(FFlareSpacecraftComponentDescription* ComponentDescription)
 {
 	DamageDirty = true;
+	Spacecraft->SetDirty();
 	if(ComponentDescription->GeneralCharacteristics.ElectricSystem)
 	{
 		SetPowerDirty();
@@ -597,6 +598,7 @@ void UFlareSimulatedSpacecraftDamageSystem::SetDamageDirty(FFlareSpacecraftCompo
 void UFlareSimulatedSpacecraftDamageSystem::SetAmmoDirty()
 {
 	AmmoDirty = true;
+	Spacecraft->SetDirty();
 }
 
 bool UFlareSimulatedSpacecraftDamageSystem::IsPowered(FFlareSpacecraftComponentSave* ComponentToPowerData) const
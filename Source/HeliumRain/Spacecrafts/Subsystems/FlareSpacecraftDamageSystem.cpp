@@ -5,6 +5,7 @@
 #include "../FlareSpacecraft.h"
 #include "../../Game/FlareGame.h"
 #include "../../Player/FlarePlayerController.h"
+#include "../../Quests/FlareQuestManager.h"
 #include "../FlareEngine.h"
 #include "../FlareOrbitalEngine.h"
 #include "../FlareShell.h"
@@ -152,6 +153,7 @@ void UFlareSpacecraftDamageSystem::TickSystem(float DeltaSeconds)
 
 		WasAlive = false;
 		OnSpacecraftDestroyed();
+		Spacecraft->GetGame()->GetQuestManager()->OnSpacecraftDestroyed(Spacecraft);
 	}
 
 	TimeSinceLastExternalDamage += DeltaSeconds;
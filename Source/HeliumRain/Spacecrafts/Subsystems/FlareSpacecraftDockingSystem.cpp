@@ -17,6 +17,7 @@ DECLARE_CYCLE_STAT(TEXT("FlareDockingSystem Tick"), STAT_FlareDockingSystem_Tick
 UFlareSpacecraftDockingSystem::UFlareSpacecraftDockingSystem(const class FObjectInitializer& PCIP)
 	: Super(PCIP)
 	, Spacecraft(NULL)
+	, SlotWorldLocationsValid(false)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareDockingSystem_Tick);
 }
@@ -45,6 +46,7 @@ void UFlareSpacecraftDockingSystem::Start()
 	int32 Count = 0;
 	TArray<UActorComponent*> ActorComponents;
 	Spacecraft->GetComponents(ActorComponents);
+	DockingSlots.Empty();
 
 	// Fill all dock slots
 	for (TArray<UActorComponent*>::TIterator ComponentIt(ActorComponents); ComponentIt; ++ComponentIt)
@@ -73,44 +75,38 @@ void UFlareSpacecraftDockingSystem::Start()
 			Count++;
 		}
 	}
-}
 
-bool UFlareSpacecraftDockingSystem::HasCompatibleDock(AFlareSpacecraft* Ship) const
-{
+	// Build the slot index
+	for (int32 SizeIndex = 0; SizeIndex < EFlarePartSize::Num; SizeIndex++)
+	{
+		SizeSlots[SizeIndex].Empty();
+	}
 	for (int32 i = 0; i < DockingSlots.Num(); i++)
 	{
-		if (DockingSlots[i].DockSize == Ship->GetSize())
-		{
-			return true;
-		}
+		SizeSlots[DockingSlots[i].DockSize].Add(i);
 	}
-	return false;
+	SlotWorldLocationsValid = false;
+	UpdateSlotIndex();
+}
+
+bool UFlareSpacecraftDockingSystem::HasCompatibleDock(AFlareSpacecraft* Ship) const
+{
+	return SizeSlots[Ship->GetSize()].Num() > 0;
 }
 
 FFlareDockingInfo UFlareSpacecraftDockingSystem::RequestDock(AFlareSpacecraft* Ship, FVector PreferredLocation)
 {
-	int32 BestIndex = -1;
-	float BestDistance = 0;
+	UpdateSlotLocations();
 
 	// Looking for nearest available slot
-	for (int32 i = 0; i < DockingSlots.Num(); i++)
-	{
-		if (!DockingSlots[i].Granted && DockingSlots[i].DockSize == Ship->GetSize())
-		{
-			float DockDistance = (Spacecraft->Airframe->GetComponentToWorld().TransformPosition(DockingSlots[i].LocalLocation) - PreferredLocation).Size();
-			if (BestIndex < 0 || DockDistance < BestDistance)
-			{
-				BestDistance = DockDistance;
-				BestIndex = i;
-			}
-		}
-	}
+	int32 BestIndex = FindNearestSlot(FreeSlots[Ship->GetSize()], PreferredLocation);
 
 	// Granted
 	if (BestIndex >= 0)
 	{
 		DockingSlots[BestIndex].Granted = true;
 		DockingSlots[BestIndex].Ship = Ship;
+		UpdateSlotIndex();
 		return DockingSlots[BestIndex];
 	}
 
@@ -118,18 +114,7 @@ FFlareDockingInfo UFlareSpacecraftDockingSystem::RequestDock(AFlareSpacecraft* S
 	else if (Ship->IsPlayerShip())
 	{
 		// Look again without constraint
-		for (int32 i = 0; i < DockingSlots.Num(); i++)
-		{
-			if (DockingSlots[i].DockSize == Ship->GetSize())
-			{
-				float DockDistance = (Spacecraft->Airframe->GetComponentToWorld().TransformPosition(DockingSlots[i].LocalLocation) - PreferredLocation).Size();
-				if (BestIndex < 0 || DockDistance < BestDistance)
-				{
-					BestDistance = DockDistance;
-					BestIndex = i;
-				}
-			}
-		}
+		BestIndex = FindNearestSlot(SizeSlots[Ship->GetSize()], PreferredLocation);
 
 		// Undock previous owner
 		FCHECK(BestIndex >= 0);
@@ -148,6 +133,7 @@ FFlareDockingInfo UFlareSpacecraftDockingSystem::RequestDock(AFlareSpacecraft* S
 		// Grant dock
 		DockingSlots[BestIndex].Granted = true;
 		DockingSlots[BestIndex].Ship = Ship;
+		UpdateSlotIndex();
 		return DockingSlots[BestIndex];
 	}
 
@@ -167,6 +153,7 @@ void UFlareSpacecraftDockingSystem::ReleaseDock(AFlareSpacecraft* Ship, int32 Do
 	DockingSlots[DockId].Granted = false;
 	DockingSlots[DockId].Occupied = false;
 	DockingSlots[DockId].Ship = NULL;
+	UpdateSlotIndex();
 }
 
 void UFlareSpacecraftDockingSystem::Dock(AFlareSpacecraft* Ship, int32 DockId)
@@ -175,41 +162,17 @@ void UFlareSpacecraftDockingSystem::Dock(AFlareSpacecraft* Ship, int32 DockId)
 	DockingSlots[DockId].Granted = true;
 	DockingSlots[DockId].Occupied = true;
 	DockingSlots[DockId].Ship = Ship;
+	UpdateSlotIndex();
 }
 
-TArray<AFlareSpacecraft*> UFlareSpacecraftDockingSystem::GetDockedShips()
+const TArray<AFlareSpacecraft*>& UFlareSpacecraftDockingSystem::GetDockedShips() const
 {
-	TArray<AFlareSpacecraft*> Result;
-
-	for (int32 i = 0; i < DockingSlots.Num(); i++)
-	{
-		if (DockingSlots[i].Granted && DockingSlots[i].Occupied)
-		{
-			//FLOGV("UFlareSpacecraftDockingSystem::GetDockedShips : found valid dock %d", i);
-			Result.AddUnique(DockingSlots[i].Ship);
-		}
-	}
-
-	return Result;
+	return DockedShips;
 }
 
 bool UFlareSpacecraftDockingSystem::HasAvailableDock(AFlareSpacecraft* Ship) const
 {
-	// Looking for slot
-	for (int32 i = 0; i < DockingSlots.Num(); i++)
-	{
-		if (DockingSlots[i].DockSize != Ship->GetSize())
-		{
-			continue;
-		}
-
-		if (!DockingSlots[i].Granted)
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return FreeSlots[Ship->GetSize()].Num() > 0;
 }
 
 int UFlareSpacecraftDockingSystem::GetDockCount() const
@@ -224,29 +187,90 @@ FFlareDockingInfo UFlareSpacecraftDockingSystem::GetDockInfo(int32 DockId)
 
 bool UFlareSpacecraftDockingSystem::IsGrantedShip(AFlareSpacecraft* ShipCanditate) const
 {
+	return GrantedShips.Contains(ShipCanditate);
+}
+
+
+bool UFlareSpacecraftDockingSystem::IsDockedShip(AFlareSpacecraft* ShipCanditate) const
+{
+	return OccupiedShips.Contains(ShipCanditate);
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void UFlareSpacecraftDockingSystem::UpdateSlotIndex()
+{
+	for (int32 SizeIndex = 0; SizeIndex < EFlarePartSize::Num; SizeIndex++)
+	{
+		FreeSlots[SizeIndex].Reset();
+	}
+	GrantedShips.Reset();
+	OccupiedShips.Reset();
+	DockedShips.Reset();
+
 	for (int32 i = 0; i < DockingSlots.Num(); i++)
 	{
-		if (DockingSlots[i].Granted && DockingSlots[i].Ship == ShipCanditate)
+		const FFlareDockingInfo& Slot = DockingSlots[i];
+
+		if (!Slot.Granted)
 		{
-			return true;
+			FreeSlots[Slot.DockSize].Add(i);
+		}
+		else
+		{
+			GrantedShips.Add(Slot.Ship);
 		}
-	}
 
-	return false;
-}
+		if (Slot.Occupied)
+		{
+			OccupiedShips.Add(Slot.Ship);
 
+			if (Slot.Granted)
+			{
+				DockedShips.AddUnique(Slot.Ship);
+			}
+		}
+	}
+}
 
-bool UFlareSpacecraftDockingSystem::IsDockedShip(AFlareSpacecraft* ShipCanditate) const
+void UFlareSpacecraftDockingSystem::UpdateSlotLocations()
 {
+	const FTransform& StationTransform = Spacecraft->Airframe->GetComponentToWorld();
+
+	// Stations rarely move, so this is usually still valid
+	if (SlotWorldLocationsValid && SlotWorldTransform.Equals(StationTransform, 0.f))
+	{
+		return;
+	}
+
+	SlotWorldTransform = StationTransform;
+	SlotWorldLocations.SetNum(DockingSlots.Num());
 	for (int32 i = 0; i < DockingSlots.Num(); i++)
 	{
-		if (DockingSlots[i].Occupied && DockingSlots[i].Ship == ShipCanditate)
+		SlotWorldLocations[i] = StationTransform.TransformPosition(DockingSlots[i].LocalLocation);
+	}
+	SlotWorldLocationsValid = true;
+}
+
+int32 UFlareSpacecraftDockingSystem::FindNearestSlot(const TArray<int32>& SlotIndices, FVector PreferredLocation) const
+{
+	int32 BestIndex = -1;
+	float BestDistance = 0;
+
+	for (int32 SlotIndex : SlotIndices)
+	{
+		float DockDistance = (SlotWorldLocations[SlotIndex] - PreferredLocation).SizeSquared();
+		if (BestIndex < 0 || DockDistance < BestDistance)
 		{
-			return true;
+			BestDistance = DockDistance;
+			BestIndex = SlotIndex;
 		}
 	}
 
-	return false;
+	return BestIndex;
 }
 
 
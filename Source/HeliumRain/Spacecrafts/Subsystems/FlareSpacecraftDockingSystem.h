@@ -25,6 +25,7 @@ struct FFlareDockingInfo
 		, Occupied(false)
 		, DockId(-1)
 		, Station(NULL)
+		, Ship(NULL)
 	{}
 };
 
@@ -57,7 +58,7 @@ public:
 	----------------------------------------------------*/
 
 	/** Get the list of docked ships */
-	virtual TArray<AFlareSpacecraft*> GetDockedShips();
+	virtual const TArray<AFlareSpacecraft*>& GetDockedShips() const;
 
 	/** Request a docking point */
 	virtual FFlareDockingInfo RequestDock(AFlareSpacecraft* Ship, FVector PreferredLocation);
@@ -81,6 +82,21 @@ public:
 
 	virtual bool IsDockedShip(AFlareSpacecraft* ShipCanditate) const;
 
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Rebuild the free slot lists and ship sets after a slot changed */
+	void UpdateSlotIndex();
+
+	/** Recompute the world location of slots if the station moved */
+	void UpdateSlotLocations();
+
+	/** Find the nearest slot among a list */
+	int32 FindNearestSlot(const TArray<int32>& SlotIndices, FVector PreferredLocation) const;
+
 protected:
 
 	/*----------------------------------------------------
@@ -96,4 +112,16 @@ protected:
 	// Dock data
 	TArray <FFlareDockingInfo>       DockingSlots;
 
+	// Slot index
+	TArray<int32>                                   FreeSlots[EFlarePartSize::Num];
+	TArray<int32>                                   SizeSlots[EFlarePartSize::Num];
+	TSet<AFlareSpacecraft*>                         GrantedShips;
+	TSet<AFlareSpacecraft*>                         OccupiedShips;
+	TArray<AFlareSpacecraft*>                       DockedShips;
+
+	// Slot locations, valid for the station transform they were computed with
+	TArray<FVector>                                 SlotWorldLocations;
+	FTransform                                      SlotWorldTransform;
+	bool                                            SlotWorldLocationsValid;
+
 };
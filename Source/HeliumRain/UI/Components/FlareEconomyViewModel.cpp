@@ -0,0 +1,210 @@
+
+#include "../../Flare.h"
+#include "FlareEconomyViewModel.h"
+#include "../../Game/FlareGame.h"
+#include "../../Game/FlareWorld.h"
+#include "../../Game/FlareCompany.h"
+#include "../../Game/FlareSimulatedSector.h"
+#include "../../Economy/FlareResource.h"
+
+
+/*----------------------------------------------------
+	Interaction
+----------------------------------------------------*/
+
+FFlareEconomyViewModel::FFlareEconomyViewModel(bool WorldMenu)
+	: EconomyVersion(0)
+	, HostilityVersion(0)
+	, WorldStatsValid(false)
+{
+	// Each menu keeps its own localization keys
+	if (WorldMenu)
+	{
+		PriceFormat = NSLOCTEXT("FlareWorldEconomyMenu", "ResourceMainPriceFormat", "{0} credits");
+		VariationFormat = NSLOCTEXT("FlareWorldEconomyMenu", "ResourceVariationFormat", "{0}{1}%");
+		VariationSignPlus = NSLOCTEXT("FlareWorldEconomyMenu", "ResourceVariationFormatSignPlus", "+");
+		VariationSignMinus = NSLOCTEXT("FlareWorldEconomyMenu", "ResourceVariationFormatSignMinus", "-");
+		NoVariationText = NSLOCTEXT("FlareWorldEconomyMenu", "ResourceMainPriceNoVariationFormat", "-");
+	}
+	else
+	{
+		PriceFormat = NSLOCTEXT("FlareResourcePricesMenu", "ResourceMainPriceFormat", "{0} credits");
+		VariationFormat = NSLOCTEXT("FlareResourcePricesMenu", "ResourceVariationFormat", "{0}{1}%");
+		VariationSignPlus = NSLOCTEXT("FlareResourcePricesMenu", "ResourceVariationFormatSignPlus", "+");
+		VariationSignMinus = NSLOCTEXT("FlareResourcePricesMenu", "ResourceVariationFormatSignMinus", "-");
+		NoVariationText = NSLOCTEXT("FlareResourcePricesMenu", "ResourceMainPriceNoVariationFormat", "-");
+	}
+}
+
+const FFlareResourcePriceView& FFlareEconomyViewModel::GetResourcePrice(UFlareSimulatedSector* Sector, FFlareResourceDescription* Resource)
+{
+	Update(Sector->GetGame()->GetGameWorld());
+
+	TMap<FFlareResourceDescription*, FFlareResourcePriceView>& SectorPrices = ResourcePrices.FindOrAdd(Sector);
+	FFlareResourcePriceView* CachedView = SectorPrices.Find(Resource);
+	if (CachedView)
+	{
+		return *CachedView;
+	}
+
+	FNumberFormattingOptions MoneyFormat;
+	MoneyFormat.MaximumFractionalDigits = 2;
+
+	FFlareResourcePriceView& View = SectorPrices.Add(Resource);
+	int64 ResourcePrice = Sector->GetResourcePrice(Resource, EFlareResourcePriceContext::Default);
+
+	View.PriceText = FText::Format(PriceFormat,
+		FText::AsNumber(ResourcePrice / 100.0f, &MoneyFormat));
+	View.DayVariationText = FormatPriceVariation(Sector, Resource, 1);
+	View.LongVariationText = FormatPriceVariation(Sector, Resource, 40);
+	View.TransportFeeText = FText::Format(PriceFormat,
+		FText::AsNumber(Resource->TransportFee / 100.0f, &MoneyFormat));
+	View.PriceColor = ComputePriceColor(Sector, Resource);
+
+	return View;
+}
+
+const FFlareSectorFriendlynessView& FFlareEconomyViewModel::GetSectorFriendlyness(UFlareSimulatedSector* Sector, UFlareCompany* TargetCompany)
+{
+	Update(Sector->GetGame()->GetGameWorld(), TargetCompany);
+
+	FFlareSectorFriendlynessView* CachedView = SectorFriendlyness.Find(Sector);
+	if (CachedView)
+	{
+		return *CachedView;
+	}
+
+	FFlareSectorFriendlynessView& View = SectorFriendlyness.Add(Sector);
+	View.Text = FText::Format(NSLOCTEXT("FlareWorldEconomyMenu", "SectorInfoFormat", "({0})"), Sector->GetSectorFriendlynessText(TargetCompany));
+	View.Color = Sector->GetSectorFriendlynessColor(TargetCompany);
+
+	return View;
+}
+
+const FText& FFlareEconomyViewModel::GetResourceWorldInfo(UFlareWorld* TargetWorld, FFlareResourceDescription* Resource)
+{
+	Update(TargetWorld);
+
+	FText* CachedInfo = ResourceWorldInfo.Find(Resource);
+	if (CachedInfo)
+	{
+		return *CachedInfo;
+	}
+
+	// Stats are computed once for all resources
+	if (!WorldStatsValid)
+	{
+		WorldStats = WorldHelper::ComputeWorldResourceStats(TargetWorld->GetGame());
+		WorldStatsValid = true;
+	}
+
+	FText& Info = ResourceWorldInfo.Add(Resource);
+	if (WorldStats.Contains(Resource))
+	{
+		FNumberFormattingOptions Format;
+		Format.MaximumFractionalDigits = 1;
+		const WorldHelper::FlareResourceStats& Stats = WorldStats[Resource];
+
+		// Balance info
+		FText BalanceText;
+		if (Stats.Balance > 0)
+		{
+			BalanceText = FText::Format(NSLOCTEXT("FlareWorldEconomyMenu", "BalanceInfoPlusFormat", "+{0} / day"),
+				FText::AsNumber(Stats.Balance, &Format));
+		}
+		else
+		{
+			BalanceText = FText::Format(NSLOCTEXT("FlareWorldEconomyMenu", "BalanceInfoNegFormat", "{0} / day"),
+				FText::AsNumber(Stats.Balance, &Format));
+		}
+
+		// Generate info
+		Info = FText::Format(NSLOCTEXT("FlareWorldEconomyMenu", "StockInfoFormat",
+				"\u2022 Worldwide stock: {0}\n\u2022 Worldwide production: {1} / day\n\u2022 Worldwide usage : {2} / day\n\u2022 Balance: {3}"),
+			FText::AsNumber(Stats.Stock),
+			FText::AsNumber(Stats.Production, &Format),
+			FText::AsNumber(Stats.Consumption, &Format),
+			BalanceText);
+	}
+
+	return Info;
+}
+
+void FFlareEconomyViewModel::Reset()
+{
+	ResourcePrices.Empty();
+	SectorFriendlyness.Empty();
+	ResourceWorldInfo.Empty();
+	WorldStats.Empty();
+	WorldStatsValid = false;
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void FFlareEconomyViewModel::Update(UFlareWorld* TargetWorld, UFlareCompany* TargetCompany)
+{
+	FCHECK(TargetWorld);
+
+	// Prices and stocks only change when a day is simulated
+	if (World.Get() != TargetWorld || EconomyVersion != TargetWorld->GetEconomyVersion())
+	{
+		Reset();
+		World = TargetWorld;
+		EconomyVersion = TargetWorld->GetEconomyVersion();
+	}
+
+	// Relations can also change during the day
+	if (TargetCompany && (Company.Get() != TargetCompany || HostilityVersion != TargetWorld->GetHostilityVersion()))
+	{
+		SectorFriendlyness.Empty();
+		Company = TargetCompany;
+		HostilityVersion = TargetWorld->GetHostilityVersion();
+	}
+}
+
+FText FFlareEconomyViewModel::FormatPriceVariation(UFlareSimulatedSector* Sector, FFlareResourceDescription* Resource, int32 MeanDuration) const
+{
+	FNumberFormattingOptions MoneyFormat;
+	MoneyFormat.MaximumFractionalDigits = 2;
+
+	int64 ResourcePrice = Sector->GetResourcePrice(Resource, EFlareResourcePriceContext::Default);
+	int64 LastResourcePrice = Sector->GetResourcePrice(Resource, EFlareResourcePriceContext::Default, MeanDuration);
+
+	if (ResourcePrice != LastResourcePrice)
+	{
+		float Variation = (((float) ResourcePrice) / ((float) LastResourcePrice) - 1);
+
+		if (FMath::Abs(Variation) >= 0.0001)
+		{
+			return FText::Format(VariationFormat,
+				(Variation > 0 ? VariationSignPlus : VariationSignMinus),
+				FText::AsNumber(FMath::Abs(Variation) * 100.0f, &MoneyFormat));
+		}
+	}
+
+	return NoVariationText;
+}
+
+FSlateColor FFlareEconomyViewModel::ComputePriceColor(UFlareSimulatedSector* Sector, FFlareResourceDescription* Resource)
+{
+	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
+
+	FLinearColor HighPriceColor = Theme.FriendlyColor;
+	FLinearColor MeanPriceColor = Theme.NeutralColor;
+	FLinearColor LowPriceColor = Theme.EnemyColor;
+
+	float ResourcePrice = Sector->GetPreciseResourcePrice(Resource);
+	float PriceRatio = (ResourcePrice - Resource->MinPrice) / (float) (Resource->MaxPrice - Resource->MinPrice);
+
+	if (PriceRatio > 0.5)
+	{
+		return FMath::Lerp(MeanPriceColor, HighPriceColor, 2.f * (PriceRatio - 0.5));
+	}
+	else
+	{
+		return FMath::Lerp(LowPriceColor, MeanPriceColor, 2.f * PriceRatio);
+	}
+}
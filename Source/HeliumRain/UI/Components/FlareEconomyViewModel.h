@@ -0,0 +1,96 @@
+#pragma once
+
+#include "../../Flare.h"
+#include "../../Game/FlareWorldHelper.h"
+
+
+class UFlareCompany;
+class UFlareWorld;
+class UFlareSimulatedSector;
+struct FFlareResourceDescription;
+
+
+/** Formatted price data for a resource in a sector */
+struct FFlareResourcePriceView
+{
+	FText                                           PriceText;
+	FText                                           DayVariationText;
+	FText                                           LongVariationText;
+	FText                                           TransportFeeText;
+	FSlateColor                                     PriceColor;
+};
+
+/** Formatted relation data for a sector */
+struct FFlareSectorFriendlynessView
+{
+	FText                                           Text;
+	FSlateColor                                     Color;
+};
+
+
+/** Economy data shown by the economy menus, formatted once per simulated day */
+class FFlareEconomyViewModel
+{
+public:
+
+	/*----------------------------------------------------
+		Interaction
+	----------------------------------------------------*/
+
+	/** Build the view model for the world economy menu, or for the resource prices menu */
+	FFlareEconomyViewModel(bool WorldMenu);
+
+	/** Get the formatted price data of a resource in a sector */
+	const FFlareResourcePriceView& GetResourcePrice(UFlareSimulatedSector* Sector, FFlareResourceDescription* Resource);
+
+	/** Get the formatted relation of a company with a sector */
+	const FFlareSectorFriendlynessView& GetSectorFriendlyness(UFlareSimulatedSector* Sector, UFlareCompany* Company);
+
+	/** Get the formatted worldwide stock, production and usage of a resource */
+	const FText& GetResourceWorldInfo(UFlareWorld* World, FFlareResourceDescription* Resource);
+
+	/** Drop all cached data */
+	void Reset();
+
+
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Drop the cached data if the world changed since it was computed */
+	void Update(UFlareWorld* World, UFlareCompany* Company = NULL);
+
+	/** Format the price variation over some days */
+	FText FormatPriceVariation(UFlareSimulatedSector* Sector, FFlareResourceDescription* Resource, int32 MeanDuration) const;
+
+	/** Get the color matching the price of a resource */
+	static FSlateColor ComputePriceColor(UFlareSimulatedSector* Sector, FFlareResourceDescription* Resource);
+
+
+	/*----------------------------------------------------
+		Protected data
+	----------------------------------------------------*/
+
+	// Texts of the owning menu
+	FText                                           PriceFormat;
+	FText                                           VariationFormat;
+	FText                                           VariationSignPlus;
+	FText                                           VariationSignMinus;
+	FText                                           NoVariationText;
+
+	// Validity
+	TWeakObjectPtr<UFlareWorld>                     World;
+	TWeakObjectPtr<UFlareCompany>                   Company;
+	int32                                           EconomyVersion;
+	int32                                           HostilityVersion;
+
+	// Cached data
+	TMap<UFlareSimulatedSector*, TMap<FFlareResourceDescription*, FFlareResourcePriceView>> ResourcePrices;
+	TMap<UFlareSimulatedSector*, FFlareSectorFriendlynessView> SectorFriendlyness;
+	TMap<FFlareResourceDescription*, FText>         ResourceWorldInfo;
+	TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> WorldStats;
+	bool                                            WorldStatsValid;
+
+};
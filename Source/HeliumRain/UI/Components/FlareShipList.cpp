@@ -21,6 +21,8 @@ void SFlareShipList::Construct(const FArguments& InArgs)
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
 	AFlarePlayerController* PC = MenuManager->GetPC();
 	OnItemSelected = InArgs._OnItemSelected;
+	NextItemOrder = 0;
+	ListDisplayed = false;
 	
 	// Build structure
 	ChildSlot
@@ -128,105 +130,63 @@ void SFlareShipList::Construct(const FArguments& InArgs)
 
 void SFlareShipList::AddFleet(UFlareFleet* Fleet)
 {
-	SpacecraftList.AddUnique(FInterfaceContainer::New(Fleet));
+	AddItem(Fleet, FInterfaceContainer::New(Fleet));
 }
 
 void SFlareShipList::AddShip(UFlareSimulatedSpacecraft* Ship)
 {
-	SpacecraftList.AddUnique(FInterfaceContainer::New(Ship));
+	AddItem(Ship, FInterfaceContainer::New(Ship));
 }
 
-void SFlareShipList::RefreshList()
+void SFlareShipList::RemoveFleet(UFlareFleet* Fleet)
 {
-	struct FSortBySize
-	{
-		FORCEINLINE bool operator()(const TSharedPtr<FInterfaceContainer> PtrA, const TSharedPtr<FInterfaceContainer> PtrB) const
-		{
-			FCHECK(PtrA.IsValid());
-			FCHECK(PtrB.IsValid());
-			UFlareSimulatedSpacecraft* A = PtrA->ShipInterfacePtr;
-			UFlareSimulatedSpacecraft* B = PtrB->ShipInterfacePtr;
-
-			if (PtrA->FleetPtr)
-			{
-				if (PtrB->FleetPtr)
-				{
-					return (PtrA->FleetPtr->GetShips().Num() > PtrB->FleetPtr->GetShips().Num());
-				}
-				else
-				{
-					return true;
-				}
-			}
-			else if (PtrB->FleetPtr)
-			{
-				return false;
-			}
-
-			if (A->IsStation())
-			{
-				return true;
-			}
-			else if (B->IsStation())
-			{
-				return false;
-			}
-			else
-			{
-				if (A->GetSize() > B->GetSize())
-				{
-					return true;
-				}
-				else if (A->GetSize() < B->GetSize())
-				{
-					return false;
-				}
-				else if (A->IsMilitary())
-				{
-					if (!B->IsMilitary())
-					{
-						return true;
-					}
-					else
-					{
-						return A->GetWeaponsSystem()->GetWeaponGroupCount() > B->GetWeaponsSystem()->GetWeaponGroupCount();
-					}
-				}
-				else
-				{
-					return false;
-				}
-			}
-			return false;
-		}
-	};
+	RemoveItem(Fleet);
+}
+
+void SFlareShipList::RemoveShip(UFlareSimulatedSpacecraft* Ship)
+{
+	RemoveItem(Ship);
+}
+
+void SFlareShipList::UpdateFleet(UFlareFleet* Fleet)
+{
+	UpdateItem(Fleet);
+}
+
+void SFlareShipList::UpdateShip(UFlareSimulatedSpacecraft* Ship)
+{
+	UpdateItem(Ship);
+}
 
+void SFlareShipList::RefreshList()
+{
 	ClearSelection();
 
 	// Apply filters
-	FilteredList.Empty();
-	for (auto Spacecraft : SpacecraftList)
+	TArray<const FFlareShipListEntry*> VisibleEntries;
+	VisibleEntries.Reserve(SpacecraftList.Num());
+	for (auto& Entry : SpacecraftList)
 	{
-		if (Spacecraft->ShipInterfacePtr)
+		if (IsItemVisible(Entry.Value.Item))
 		{
-			bool IsStation = Spacecraft->ShipInterfacePtr->IsStation();
-			bool IsMilitary = Spacecraft->ShipInterfacePtr->IsMilitary();
-
-			if ((IsStation && ShowStationsButton->IsActive())
-			 || (IsMilitary && ShowMilitaryButton->IsActive())
-			 || (!IsStation && !IsMilitary && ShowFreightersButton->IsActive()))
-			{
-				FilteredList.Add(Spacecraft);
-			}
-		}
-		else
-		{
-			FilteredList.Add(Spacecraft);
+			VisibleEntries.Add(&Entry.Value);
 		}
 	}
 
-	// Sort and update
-	FilteredList.Sort(FSortBySize());
+	// Sort on the precomputed keys
+	VisibleEntries.Sort([](const FFlareShipListEntry& A, const FFlareShipListEntry& B)
+	{
+		return IsBefore(A, B);
+	});
+
+	FilteredList.Empty(VisibleEntries.Num());
+	for (const FFlareShipListEntry* Entry : VisibleEntries)
+	{
+		FilteredList.Add(Entry->Item);
+	}
+
+	// Update
+	ListDisplayed = true;
 	ListWidget->RequestListRefresh();
 	SlatePrepass(FSlateApplicationBase::Get().GetApplicationScale());
 }
@@ -250,6 +210,169 @@ void SFlareShipList::Reset()
 	ListWidget->ClearSelection();
 	ListWidget->RequestListRefresh();
 	SelectedItem.Reset();
+	PreviousSelection.Reset();
+	NextItemOrder = 0;
+	ListDisplayed = false;
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void SFlareShipList::AddItem(UObject* Object, TSharedPtr<FInterfaceContainer> Item)
+{
+	if (SpacecraftList.Contains(Object))
+	{
+		return;
+	}
+
+	FFlareShipListEntry& Entry = SpacecraftList.Add(Object);
+	Entry.Item = Item;
+	Entry.SortKey = GetSortKey(Item);
+	Entry.Order = NextItemOrder++;
+
+	// Only this row needs to be built if the list is already displayed
+	if (ListDisplayed && IsItemVisible(Item))
+	{
+		InsertFilteredItem(Entry);
+		ListWidget->RequestListRefresh();
+	}
+}
+
+void SFlareShipList::RemoveItem(UObject* Object)
+{
+	FFlareShipListEntry Entry;
+	if (!SpacecraftList.RemoveAndCopyValue(Object, Entry))
+	{
+		return;
+	}
+
+	if (SelectedItem == Entry.Item)
+	{
+		ClearSelection();
+		SelectedItem.Reset();
+		PreviousSelection.Reset();
+	}
+
+	if (ListDisplayed && FilteredList.Remove(Entry.Item) > 0)
+	{
+		ListWidget->RequestListRefresh();
+	}
+}
+
+void SFlareShipList::UpdateItem(UObject* Object)
+{
+	FFlareShipListEntry* Entry = SpacecraftList.Find(Object);
+	if (!Entry)
+	{
+		return;
+	}
+
+	Entry->SortKey = GetSortKey(Entry->Item);
+
+	if (ListDisplayed)
+	{
+		FilteredList.Remove(Entry->Item);
+
+		// The selected row is about to be replaced
+		if (SelectedItem == Entry->Item)
+		{
+			ClearSelection();
+			SelectedItem.Reset();
+			PreviousSelection.Reset();
+		}
+
+		// Rows are keyed by item, so a new item only regenerates this row
+		Entry->Item = MakeShareable(new FInterfaceContainer(*Entry->Item));
+
+		if (IsItemVisible(Entry->Item))
+		{
+			InsertFilteredItem(*Entry);
+		}
+		ListWidget->RequestListRefresh();
+	}
+}
+
+void SFlareShipList::InsertFilteredItem(const FFlareShipListEntry& Entry)
+{
+	// Binary search for the first row displayed after this one
+	int32 Min = 0;
+	int32 Max = FilteredList.Num();
+	while (Min < Max)
+	{
+		int32 Middle = (Min + Max) / 2;
+		const FFlareShipListEntry* MiddleEntry = SpacecraftList.Find(GetItemObject(FilteredList[Middle]));
+		FCHECK(MiddleEntry);
+
+		if (IsBefore(*MiddleEntry, Entry))
+		{
+			Min = Middle + 1;
+		}
+		else
+		{
+			Max = Middle;
+		}
+	}
+
+	FilteredList.Insert(Entry.Item, Min);
+}
+
+bool SFlareShipList::IsItemVisible(const TSharedPtr<FInterfaceContainer>& Item) const
+{
+	if (Item->ShipInterfacePtr)
+	{
+		bool IsStation = Item->ShipInterfacePtr->IsStation();
+		bool IsMilitary = Item->ShipInterfacePtr->IsMilitary();
+
+		return ((IsStation && ShowStationsButton->IsActive())
+		 || (IsMilitary && ShowMilitaryButton->IsActive())
+		 || (!IsStation && !IsMilitary && ShowFreightersButton->IsActive()));
+	}
+	else
+	{
+		return true;
+	}
+}
+
+int64 SFlareShipList::GetSortKey(const TSharedPtr<FInterfaceContainer>& Item)
+{
+	FCHECK(Item.IsValid());
+
+	// Fleets first, largest first
+	if (Item->FleetPtr)
+	{
+		return (3LL << 40) + Item->FleetPtr->GetShips().Num();
+	}
+
+	UFlareSimulatedSpacecraft* Ship = Item->ShipInterfacePtr;
+	FCHECK(Ship);
+
+	// Then stations
+	if (Ship->IsStation())
+	{
+		return (2LL << 40);
+	}
+
+	// Then ships by size, military ships first and by armament
+	int64 Key = (1LL << 40) + ((int64)Ship->GetSize() << 20);
+	if (Ship->IsMilitary())
+	{
+		Key += (1 << 16) + Ship->GetWeaponsSystem()->GetWeaponGroupCount();
+	}
+	return Key;
+}
+
+UObject* SFlareShipList::GetItemObject(const TSharedPtr<FInterfaceContainer>& Item)
+{
+	if (Item->FleetPtr)
+	{
+		return Item->FleetPtr;
+	}
+	else
+	{
+		return Item->ShipInterfacePtr;
+	}
 }
 
 
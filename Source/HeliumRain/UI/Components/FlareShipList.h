@@ -7,6 +7,15 @@
 DECLARE_DELEGATE_OneParam(FFlareListItemSelected, TSharedPtr<FInterfaceContainer>)
 
 
+/** List entry with its precomputed sort data */
+struct FFlareShipListEntry
+{
+	TSharedPtr<FInterfaceContainer> Item;
+	int64                           SortKey;
+	int32                           Order;
+};
+
+
 class SFlareShipList : public SCompoundWidget
 {
 	/*----------------------------------------------------
@@ -40,6 +49,18 @@ public:
 	/** Add a new ship to the list */
 	void AddShip(UFlareSimulatedSpacecraft* Ship);
 
+	/** Remove a fleet from the list */
+	void RemoveFleet(UFlareFleet* Fleet);
+
+	/** Remove a ship from the list */
+	void RemoveShip(UFlareSimulatedSpacecraft* Ship);
+
+	/** Signal that a fleet changed, and move it to its new place */
+	void UpdateFleet(UFlareFleet* Fleet);
+
+	/** Signal that a ship changed, and move it to its new place */
+	void UpdateShip(UFlareSimulatedSpacecraft* Ship);
+
 	/** Update the list display from content */
 	void RefreshList();
 
@@ -55,6 +76,40 @@ public:
 	}
 
 
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Add an item, or insert it in place if the list is already displayed */
+	void AddItem(UObject* Object, TSharedPtr<FInterfaceContainer> Item);
+
+	/** Remove an item, and its row if the list is already displayed */
+	void RemoveItem(UObject* Object);
+
+	/** Compute the sort key of an item again, and move and regenerate its row */
+	void UpdateItem(UObject* Object);
+
+	/** Insert a displayed row at its sorted position */
+	void InsertFilteredItem(const FFlareShipListEntry& Entry);
+
+	/** Check if an item passes the current filters */
+	bool IsItemVisible(const TSharedPtr<FInterfaceContainer>& Item) const;
+
+	/** Get the ordering key of an item : fleets by size, then stations, then ships by size and armament */
+	static int64 GetSortKey(const TSharedPtr<FInterfaceContainer>& Item);
+
+	/** Get the object displayed by an item */
+	static UObject* GetItemObject(const TSharedPtr<FInterfaceContainer>& Item);
+
+	/** Check if entry A is displayed before entry B */
+	static bool IsBefore(const FFlareShipListEntry& A, const FFlareShipListEntry& B)
+	{
+		return (A.SortKey > B.SortKey || (A.SortKey == B.SortKey && A.Order < B.Order));
+	}
+
+
 protected:
 
 	/*----------------------------------------------------
@@ -88,9 +143,13 @@ protected:
 	TSharedPtr<SFlareListItem>                                   PreviousSelection;
 	TSharedPtr< SListView< TSharedPtr<FInterfaceContainer> > >   ListWidget;
 	TArray< TSharedPtr<FInterfaceContainer> >                    FilteredList;
-	TArray< TSharedPtr<FInterfaceContainer> >                    SpacecraftList;
 	TSharedPtr<FInterfaceContainer>                              SelectedItem;
 
+	// List data, keyed by ship or fleet
+	TMap<UObject*, FFlareShipListEntry>                          SpacecraftList;
+	int32                                                        NextItemOrder;
+	bool                                                         ListDisplayed;
+
 	// Filters
 	TSharedPtr<SFlareButton>                                     ShowStationsButton;
 	TSharedPtr<SFlareButton>                                     ShowMilitaryButton;
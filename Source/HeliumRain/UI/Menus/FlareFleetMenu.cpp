@@ -416,12 +416,19 @@ void SFlareFleetMenu::OnSelectFleet()
 {
 	FCHECK(FleetToAdd);
 
+	UFlareFleet* PreviousFleet = SelectedFleet;
 	SelectedFleet = FleetToAdd;
 	EditFleetName->SetText(SelectedFleet->GetFleetName());
 	FLOGV("SFlareFleetMenu::OnSelectFleet : selected '%s'", *SelectedFleet->GetFleetName().ToString());
 
+	// Swap the previous and new selected fleets in the fleet list
+	FleetList->RemoveFleet(SelectedFleet);
+	if (PreviousFleet && PreviousFleet->GetShips().Num())
+	{
+		FleetList->AddFleet(PreviousFleet);
+	}
+
 	UpdateShipList();
-	UpdateFleetList();
 	FleetToAdd = NULL;
 	ShipToRemove = NULL;
 }
@@ -432,10 +439,26 @@ void SFlareFleetMenu::OnAddToFleet()
 	FCHECK(FleetToAdd);
 
 	FLOGV("SFlareFleetMenu::OnAddToFleet : adding '%s'", *FleetToAdd->GetFleetName().ToString());
+	TArray<UFlareSimulatedSpacecraft*> MergedShips = FleetToAdd->GetShips();
 	SelectedFleet->Merge(FleetToAdd);
 
-	UpdateShipList();
-	UpdateFleetList();
+	// Only update the rows that changed, some ships may have stayed in their fleet
+	for (UFlareSimulatedSpacecraft* Ship : MergedShips)
+	{
+		if (Ship->GetCurrentFleet() == SelectedFleet && Ship->GetDamageSystem()->IsAlive())
+		{
+			ShipList->AddShip(Ship);
+		}
+	}
+
+	if (FleetToAdd->GetShips().Num())
+	{
+		FleetList->UpdateFleet(FleetToAdd);
+	}
+	else
+	{
+		FleetList->RemoveFleet(FleetToAdd);
+	}
 	FleetToAdd = NULL;
 	ShipToRemove = NULL;
 }
@@ -448,8 +471,15 @@ void SFlareFleetMenu::OnRemoveFromFleet()
 	FLOGV("SFlareFleetMenu::OnRemoveFromFleet : removing '%s'", *ShipToRemove->GetImmatriculation().ToString());
 	SelectedFleet->RemoveShip(ShipToRemove);
 
-	UpdateShipList();
-	UpdateFleetList();
+	// Only update the rows that changed
+	if (ShipToRemove->GetCurrentFleet() != SelectedFleet)
+	{
+		ShipList->RemoveShip(ShipToRemove);
+		if (ShipToRemove->GetCurrentFleet())
+		{
+			FleetList->AddFleet(ShipToRemove->GetCurrentFleet());
+		}
+	}
 	FleetToAdd = NULL;
 	ShipToRemove = NULL;
 }
@@ -2,6 +2,7 @@
 #include "../../Flare.h"
 #include "FlareResourcePricesMenu.h"
 #include "FlareWorldEconomyMenu.h"
+#include "../Components/FlareEconomyViewModel.h"
 #include "../../Game/FlareGame.h"
 #include "../../Economy/FlareResource.h"
 #include "../../Player/FlareMenuManager.h"
@@ -18,6 +19,7 @@
 void SFlareResourcePricesMenu::Construct(const FArguments& InArgs)
 {
 	MenuManager = InArgs._MenuManager;
+	EconomyViewModel = MakeShareable(new FFlareEconomyViewModel(false));
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
 
 	// Build structure
@@ -291,6 +293,7 @@ void SFlareResourcePricesMenu::Exit()
 	SetEnabled(false);
 	SetVisibility(EVisibility::Collapsed);
 	ResourcePriceList->ClearChildren();
+	EconomyViewModel->Reset();
 	TargetSector = NULL;
 }
 
@@ -304,22 +307,7 @@ FSlateColor SFlareResourcePricesMenu::GetPriceColor(FFlareResourceDescription* R
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
 	if (TargetSector)
 	{
-		FLinearColor HighPriceColor = Theme.FriendlyColor;
-		FLinearColor MeanPriceColor = Theme.NeutralColor;
-		FLinearColor LowPriceColor = Theme.EnemyColor;
-
-		float ResourcePrice = TargetSector->GetPreciseResourcePrice(Resource);
-
-		float PriceRatio = (ResourcePrice - Resource->MinPrice) / (float) (Resource->MaxPrice - Resource->MinPrice);
-
-		if(PriceRatio  > 0.5)
-		{
-			return FMath::Lerp(MeanPriceColor, HighPriceColor, 2.f * (PriceRatio - 0.5));
-		}
-		else
-		{
-			return FMath::Lerp(LowPriceColor, MeanPriceColor, 2.f * PriceRatio);
-		}
+		return EconomyViewModel->GetResourcePrice(TargetSector, Resource).PriceColor;
 	}
 	return Theme.FriendlyColor;
 }
@@ -349,13 +337,7 @@ FText SFlareResourcePricesMenu::GetResourcePriceInfo(FFlareResourceDescription*
 {
 	if (TargetSector)
 	{
-		FNumberFormattingOptions MoneyFormat;
-		MoneyFormat.MaximumFractionalDigits = 2;
-
-		int64 ResourcePrice = TargetSector->GetResourcePrice(Resource, EFlareResourcePriceContext::Default);
-
-		return FText::Format(LOCTEXT("ResourceMainPriceFormat", "{0} credits"),
-			FText::AsNumber(ResourcePrice / 100.0f, &MoneyFormat));
+		return EconomyViewModel->GetResourcePrice(TargetSector, Resource).PriceText;
 	}
 
 	return FText();
@@ -365,28 +347,7 @@ FText SFlareResourcePricesMenu::GetResourcePriceVariationInfo(FFlareResourceDesc
 {
 	if (TargetSector)
 	{
-		FNumberFormattingOptions MoneyFormat;
-		MoneyFormat.MaximumFractionalDigits = 2;
-
-		int32 MeanDuration = 40;
-		int64 ResourcePrice = TargetSector->GetResourcePrice(Resource, EFlareResourcePriceContext::Default);
-		int64 LastResourcePrice = TargetSector->GetResourcePrice(Resource, EFlareResourcePriceContext::Default, MeanDuration);
-
-		if(ResourcePrice != LastResourcePrice)
-		{
-			float Variation = (((float) ResourcePrice) / ((float) LastResourcePrice) - 1);
-
-			if(FMath::Abs(Variation) >= 0.0001)
-			{
-				return FText::Format(LOCTEXT("ResourceVariationFormat", "{0}{1}%"),
-								(Variation > 0 ?
-									 FText::FText(LOCTEXT("ResourceVariationFormatSignPlus","+")) :
-									 FText::FText(LOCTEXT("ResourceVariationFormatSignMinus","-"))),
-							  FText::AsNumber(FMath::Abs(Variation) * 100.0f, &MoneyFormat));
-			}
-		}
-
-		return FText::FText(LOCTEXT("ResourceMainPriceNoVariationFormat", "-"));
+		return EconomyViewModel->GetResourcePrice(TargetSector, Resource).LongVariationText;
 	}
 
 	return FText();
@@ -396,11 +357,7 @@ FText SFlareResourcePricesMenu::GetResourceTransportFeeInfo(FFlareResourceDescri
 {
 	if (TargetSector)
 	{
-		FNumberFormattingOptions MoneyFormat;
-		MoneyFormat.MaximumFractionalDigits = 2;
-
-		return FText::Format(LOCTEXT("ResourceMainPriceFormat", "{0} credits"),
-			FText::AsNumber(Resource->TransportFee / 100.0f, &MoneyFormat));
+		return EconomyViewModel->GetResourcePrice(TargetSector, Resource).TransportFeeText;
 	}
 
 	return FText();
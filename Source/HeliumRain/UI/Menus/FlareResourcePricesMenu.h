@@ -5,6 +5,7 @@
 
 
 class AFlareMenuManager;
+class FFlareEconomyViewModel;
 struct FFlareResourceDescription;
 
 
@@ -72,6 +73,7 @@ protected:
 	// Target data
 	TWeakObjectPtr<class AFlareMenuManager>         MenuManager;
 	UFlareSimulatedSector*                          TargetSector;
+	TSharedPtr<FFlareEconomyViewModel>              EconomyViewModel;
 
 	// Slate data
 	TSharedPtr<SVerticalBox>                        ResourcePriceList;
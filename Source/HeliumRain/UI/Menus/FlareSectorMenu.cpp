@@ -988,12 +988,10 @@ void SFlareSectorMenu::OnBuildStationSelected(FFlareSpacecraftDescription* NewSt
 				MenuManager->OpenMenu(EFlareMenu::MENU_ReloadSector, MenuParameters);
 			}
 
-			// Other sector
-			else
+			// Other sector, only add the new row
+			else if (NewStation)
 			{
-				FFlareMenuParameterData MenuParameters;
-				MenuParameters.Sector = TargetSector;
-				MenuManager->OpenMenu(EFlareMenu::MENU_Sector, MenuParameters);
+				OwnedShipList->AddShip(NewStation);
 			}
 
 			// Notify
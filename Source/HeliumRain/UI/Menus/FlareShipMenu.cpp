@@ -297,7 +297,7 @@ void SFlareShipMenu::Enter(UFlareSimulatedSpacecraft* Target, bool IsEditable)
 	// Fill the docking list if it is visible
 	if (DockSystem && DockSystem->GetDockCount() > 0)
 	{
-		TArray<AFlareSpacecraft*> DockedShips = DockSystem->GetDockedShips();
+		const TArray<AFlareSpacecraft*>& DockedShips = DockSystem->GetDockedShips();
 		for (int32 i = 0; i < DockedShips.Num(); i++)
 		{
 			AFlareSpacecraft* Spacecraft = DockedShips[i];
@@ -1,6 +1,7 @@
 
 #include "../../Flare.h"
 #include "FlareWorldEconomyMenu.h"
+#include "../Components/FlareEconomyViewModel.h"
 #include "../../Game/FlareGame.h"
 #include "../../Economy/FlareResource.h"
 #include "../../Player/FlareMenuManager.h"
@@ -17,6 +18,7 @@
 void SFlareWorldEconomyMenu::Construct(const FArguments& InArgs)
 {
 	MenuManager = InArgs._MenuManager;
+	EconomyViewModel = MakeShareable(new FFlareEconomyViewModel(true));
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
 
 	// Build structure
@@ -230,7 +232,6 @@ void SFlareWorldEconomyMenu::Enter(FFlareResourceDescription* Resource, UFlareSi
 	SetVisibility(EVisibility::Visible);
 
 	TargetResource = Resource;
-	WorldStats = WorldHelper::ComputeWorldResourceStats(MenuManager->GetGame());
 
 	// Update resource selector
 	ResourceSelector->RefreshOptions();
@@ -332,7 +333,7 @@ void SFlareWorldEconomyMenu::GenerateSectorList()
 					[
 						SNew(STextBlock)
 						.TextStyle(&Theme.TextFont)
-						.Text(this, &SFlareWorldEconomyMenu::GetResourcePriceVariationInfo, Sector, TSharedPtr<int32>(new int32(1)))
+						.Text(this, &SFlareWorldEconomyMenu::GetResourcePriceVariationInfo, Sector, false)
 					]
 				]
 
@@ -348,7 +349,7 @@ void SFlareWorldEconomyMenu::GenerateSectorList()
 					[
 						SNew(STextBlock)
 						.TextStyle(&Theme.TextFont)
-						.Text(this, &SFlareWorldEconomyMenu::GetResourcePriceVariationInfo, Sector, TSharedPtr<int32>(new int32(40)))
+						.Text(this, &SFlareWorldEconomyMenu::GetResourcePriceVariationInfo, Sector, true)
 					]
 				]
 
@@ -376,6 +377,7 @@ void SFlareWorldEconomyMenu::Exit()
 	SetEnabled(false);
 	SetVisibility(EVisibility::Collapsed);
 	SectorList->ClearChildren();
+	EconomyViewModel->Reset();
 	TargetResource = NULL;
 }
 
@@ -389,25 +391,7 @@ FSlateColor SFlareWorldEconomyMenu::GetPriceColor(UFlareSimulatedSector* Sector)
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
 	if (TargetResource)
 	{
-
-		FLinearColor HighPriceColor = Theme.FriendlyColor;
-		FLinearColor MeanPriceColor = Theme.NeutralColor;
-		FLinearColor LowPriceColor = Theme.EnemyColor;
-
-		float ResourcePrice = Sector->GetPreciseResourcePrice(TargetResource);
-
-		float PriceRatio = (ResourcePrice - TargetResource->MinPrice) / (float) (TargetResource->MaxPrice - TargetResource->MinPrice);
-
-		if(PriceRatio  > 0.5)
-		{
-			return FMath::Lerp(MeanPriceColor, HighPriceColor, 2.f * (PriceRatio - 0.5));
-		}
-		else
-		{
-			return FMath::Lerp(LowPriceColor, MeanPriceColor, 2.f * PriceRatio);
-		}
-
-		return FMath::Lerp(LowPriceColor, HighPriceColor, PriceRatio);
+		return EconomyViewModel->GetResourcePrice(Sector, TargetResource).PriceColor;
 	}
 	return Theme.FriendlyColor;
 }
@@ -426,33 +410,7 @@ FText SFlareWorldEconomyMenu::GetResourceInfo() const
 {
 	if (TargetResource)
 	{
-		if (WorldStats.Contains(TargetResource))
-		{
-			FNumberFormattingOptions Format;
-			Format.MaximumFractionalDigits = 1;
-
-			// Balance info
-			FText BalanceText;
-			float Balance = WorldStats[TargetResource].Balance;
-			if (Balance > 0)
-			{
-				BalanceText = FText::Format(LOCTEXT("BalanceInfoPlusFormat", "+{0} / day"),
-					FText::AsNumber(Balance, &Format));
-			}
-			else
-			{
-				BalanceText = FText::Format(LOCTEXT("BalanceInfoNegFormat", "{0} / day"),
-					FText::AsNumber(Balance, &Format));
-			}
-			
-			// Generate info
-			return FText::Format(LOCTEXT("StockInfoFormat",
-					"\u2022 Worldwide stock: {0}\n\u2022 Worldwide production: {1} / day\n\u2022 Worldwide usage : {2} / day\n\u2022 Balance: {3}"),
-				FText::AsNumber(WorldStats[TargetResource].Stock),
-				FText::AsNumber(WorldStats[TargetResource].Production, &Format),
-				FText::AsNumber(WorldStats[TargetResource].Consumption, &Format),
-				BalanceText);
-		}
+		return EconomyViewModel->GetResourceWorldInfo(MenuManager->GetGame()->GetGameWorld(), TargetResource);
 	}
 
 	return FText();
@@ -460,55 +418,30 @@ FText SFlareWorldEconomyMenu::GetResourceInfo() const
 
 FText SFlareWorldEconomyMenu::GetSectorText(UFlareSimulatedSector* Sector) const
 {
-	return FText::Format(LOCTEXT("SectorInfoFormat", "({0})"),
-		Sector->GetSectorFriendlynessText(MenuManager->GetPC()->GetCompany()));
+	return EconomyViewModel->GetSectorFriendlyness(Sector, MenuManager->GetPC()->GetCompany()).Text;
 }
 
 FSlateColor SFlareWorldEconomyMenu::GetSectorTextColor(UFlareSimulatedSector* Sector) const
 {
-	return Sector->GetSectorFriendlynessColor(MenuManager->GetPC()->GetCompany());
+	return EconomyViewModel->GetSectorFriendlyness(Sector, MenuManager->GetPC()->GetCompany()).Color;
 }
 
 FText SFlareWorldEconomyMenu::GetResourcePriceInfo(UFlareSimulatedSector* Sector) const
 {
 	if (TargetResource)
 	{
-		FNumberFormattingOptions MoneyFormat;
-		MoneyFormat.MaximumFractionalDigits = 2;
-
-		int64 ResourcePrice = Sector->GetResourcePrice(TargetResource, EFlareResourcePriceContext::Default);
-
-		return FText::Format(LOCTEXT("ResourceMainPriceFormat", "{0} credits"),
-			FText::AsNumber(ResourcePrice / 100.0f, &MoneyFormat));
+		return EconomyViewModel->GetResourcePrice(Sector, TargetResource).PriceText;
 	}
 
 	return FText();
 }
 
-FText SFlareWorldEconomyMenu::GetResourcePriceVariationInfo(UFlareSimulatedSector* Sector, TSharedPtr<int32> MeanDuration) const
+FText SFlareWorldEconomyMenu::GetResourcePriceVariationInfo(UFlareSimulatedSector* Sector, bool LongVariation) const
 {
 	if (TargetResource)
 	{
-		FNumberFormattingOptions MoneyFormat;
-		MoneyFormat.MaximumFractionalDigits = 2;
-
-		int64 ResourcePrice = Sector->GetResourcePrice(TargetResource, EFlareResourcePriceContext::Default);
-		int64 LastResourcePrice = Sector->GetResourcePrice(TargetResource, EFlareResourcePriceContext::Default, *MeanDuration);
-
-		if(ResourcePrice != LastResourcePrice)
-		{
-			float Variation = (((float) ResourcePrice) / ((float) LastResourcePrice) - 1);
-
-			if(FMath::Abs(Variation) >= 0.0001)
-			{
-				return FText::Format(LOCTEXT("ResourceVariationFormat", "{0}{1}%"),
-								(Variation > 0 ?
-									 FText::FText(LOCTEXT("ResourceVariationFormatSignPlus","+")) :
-									 FText::FText(LOCTEXT("ResourceVariationFormatSignMinus","-"))),
-							  FText::AsNumber(FMath::Abs(Variation) * 100.0f, &MoneyFormat));
-			}
-		}
-		return FText::FText(LOCTEXT("ResourceMainPriceNoVariationFormat", "-"));
+		const FFlareResourcePriceView& PriceView = EconomyViewModel->GetResourcePrice(Sector, TargetResource);
+		return (LongVariation ? PriceView.LongVariationText : PriceView.DayVariationText);
 	}
 
 	return FText();
@@ -2,12 +2,12 @@
 
 #include "../../Flare.h"
 #include "../Components/FlareButton.h"
-#include "../../Game/FlareWorldHelper.h"
 #include "../../Data/FlareResourceCatalogEntry.h"
 
 
 class UFlareSimulatedSector;
 class AFlareMenuManager;
+class FFlareEconomyViewModel;
 struct FFlareResourceDescription;
 class UFlareResourceCatalogEntry;
 
@@ -67,8 +67,8 @@ protected:
 	/** Get the resource price info */
 	FText GetResourcePriceInfo(UFlareSimulatedSector* Sector) const;
 
-	/** Get the resource price variation info */
-	FText GetResourcePriceVariationInfo(UFlareSimulatedSector* Sector, TSharedPtr<int32> MeanDuration) const;
+	/** Get the resource price variation info, over one day or over 40 days */
+	FText GetResourcePriceVariationInfo(UFlareSimulatedSector* Sector, bool LongVariation) const;
 
 	TSharedRef<SWidget> OnGenerateResourceComboLine(UFlareResourceCatalogEntry* Item);
 
@@ -87,7 +87,7 @@ protected:
 	// Target data
 	TWeakObjectPtr<class AFlareMenuManager>         MenuManager;
 	FFlareResourceDescription*                      TargetResource;
-	TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> WorldStats;
+	TSharedPtr<FFlareEconomyViewModel>              EconomyViewModel;
 
 	// Slate data
 	TSharedPtr<SVerticalBox>                        SectorList;
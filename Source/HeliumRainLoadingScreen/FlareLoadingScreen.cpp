@@ -31,6 +31,43 @@ struct FFlareLoadingScreenBrush : public FSlateDynamicImageBrush, public FGCObje
 };
 
 
+/*----------------------------------------------------
+	Loading progress
+----------------------------------------------------*/
+
+/** Progress shared between the loading code and the loading screen thread */
+struct FFlareLoadingProgress
+{
+	FFlareLoadingProgress()
+		: Progress(0)
+	{
+	}
+
+	void Set(float NewProgress, FText NewStatus)
+	{
+		FScopeLock Lock(&ProgressLock);
+		Progress = FMath::Clamp(NewProgress, 0.0f, 1.0f);
+		Status = NewStatus;
+	}
+
+	TOptional<float> GetProgress() const
+	{
+		FScopeLock Lock(&ProgressLock);
+		return Progress;
+	}
+
+	FText GetStatus() const
+	{
+		FScopeLock Lock(&ProgressLock);
+		return Status;
+	}
+
+	mutable FCriticalSection                 ProgressLock;
+	float                                    Progress;
+	FText                                    Status;
+};
+
+
 /*----------------------------------------------------
 	Screen layout
 ----------------------------------------------------*/
@@ -40,11 +77,17 @@ class SFlareLoadingScreen : public SCompoundWidget
 
 public:
 
-	SLATE_BEGIN_ARGS(SFlareLoadingScreen){}
+	SLATE_BEGIN_ARGS(SFlareLoadingScreen)
+		: _LoadingProgress(NULL)
+	{}
+	SLATE_ARGUMENT(FFlareLoadingProgress*, LoadingProgress)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs)
 	{
+		LoadingProgress = InArgs._LoadingProgress;
+		check(LoadingProgress);
+
 		// Get brush data
 		static const FName LoadingScreenName(TEXT("/Engine/EngineResources/Black.Black"));
 		static const FName ThrobberImageName(TEXT("/Game/Slate/Images/TX_Image_LargeButtonInvertedBackground.TX_Image_LargeButtonInvertedBackground"));
@@ -95,12 +138,51 @@ public:
 					.PieceImage(ThrobberBrush.Get())
 					.NumPieces(5)
 				]
+
+				// Progress
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.HAlign(HAlign_Center)
+				.Padding(FMargin(10.0f))
+				[
+					SNew(SBox)
+					.WidthOverride(600)
+					[
+						SNew(SProgressBar)
+						.Percent(this, &SFlareLoadingScreen::GetProgress)
+					]
+				]
+
+				// Status
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.VAlign(VAlign_Top)
+				.HAlign(HAlign_Center)
+				.Padding(FMargin(10.0f, 10.0f, 10.0f, 100.0f))
+				[
+					SNew(STextBlock)
+					.Text(this, &SFlareLoadingScreen::GetStatus)
+					.Font(FSlateFontInfo(FPaths::GameContentDir() / TEXT("Slate/Fonts/Lato700.ttf"), 20))
+				]
 			]
 		];
 	}
 
 private:
-	
+
+	TOptional<float> GetProgress() const
+	{
+		return LoadingProgress->GetProgress();
+	}
+
+	FText GetStatus() const
+	{
+		return LoadingProgress->GetStatus();
+	}
+
+	// Loading data
+	FFlareLoadingProgress*                   LoadingProgress;
+
 	// Slate data
 	TSharedPtr<FSlateDynamicImageBrush> ThrobberBrush;
 	TSharedPtr<FSlateDynamicImageBrush> LoadingScreenBrush;
@@ -133,19 +215,35 @@ public:
 
 	virtual void StartInGameLoadingScreen() override
 	{
+		LoadingProgress.Set(0, FText());
 		CreateScreen();
 
 		GetMoviePlayer()->PlayMovie();
 	}
 
+	virtual void StopInGameLoadingScreen() override
+	{
+		// The screen completes automatically, this only waits for the rendering thread to let go
+		GetMoviePlayer()->WaitForMovieToFinish();
+	}
+
+	virtual void SetLoadingProgress(float Progress, FText Status) override
+	{
+		LoadingProgress.Set(Progress, Status);
+	}
+
 	virtual void CreateScreen()
 	{
 		FLoadingScreenAttributes LoadingScreen;
 		LoadingScreen.bAutoCompleteWhenLoadingCompletes = true;
-		LoadingScreen.WidgetLoadingScreen = SNew(SFlareLoadingScreen);
+		LoadingScreen.WidgetLoadingScreen = SNew(SFlareLoadingScreen).LoadingProgress(&LoadingProgress);
 		GetMoviePlayer()->SetupLoadingScreen(LoadingScreen);
 	}
 
+private:
+
+	FFlareLoadingProgress                    LoadingProgress;
+
 };
 
 #undef LOCTEXT_NAMESPACE
@@ -14,4 +14,10 @@ public:
 
 	virtual void StartInGameLoadingScreen() = 0;
 
+	/** Hide the in-game loading screen once loading is done */
+	virtual void StopInGameLoadingScreen() = 0;
+
+	/** Report the loading progress between 0 and 1, can be called from any thread */
+	virtual void SetLoadingProgress(float Progress, FText Status) = 0;
+
 };